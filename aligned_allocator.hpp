@@ -0,0 +1,114 @@
+#pragma once
+#ifndef ALIGNED_ALLOCATOR_HPP
+#define ALIGNED_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include "utils.hpp"
+
+namespace ft
+{
+	/*
+	** Allocator whose blocks start on an Align-byte boundary: 32 for AVX
+	** loads, 64 for a cache line, 4096 for a page. Align must be a power of
+	** two and at least sizeof(void*). It rebinds like std::allocator, so any
+	** ft container takes it as its Alloc parameter; ft::vector additionally
+	** rounds its capacity up to whole Align-byte granules (see
+	** allocation_granularity), so a kernel may run full-width loads and
+	** stores over the last partial vector of elements without leaving the
+	** block.
+	*/
+	template <class T, size_t Align = 64>
+	class aligned_allocator
+	{
+		typedef char align_must_be_a_power_of_two[(Align & (Align - 1)) == 0 && Align >= sizeof(void*) ? 1 : -1];
+	public:
+		typedef T				value_type;
+		typedef T*				pointer;
+		typedef const T*		const_pointer;
+		typedef T&				reference;
+		typedef const T&		const_reference;
+		typedef size_t			size_type;
+		typedef std::ptrdiff_t	difference_type;
+
+		template <class U>
+		struct rebind { typedef aligned_allocator<U, Align> other; };
+
+		static const size_t	alignment = Align;
+
+		aligned_allocator() {}
+		template <class U>
+		aligned_allocator(const aligned_allocator<U, Align>&) {}
+
+		pointer address (reference x) const
+		{
+			return (&x);
+		}
+
+		const_pointer address (const_reference x) const
+		{
+			return (&x);
+		}
+
+		size_type max_size() const
+		{
+			return ((size_type)-1 / sizeof(T));
+		}
+
+		pointer allocate (size_type n, const void* = 0)
+		{
+			void	*p = NULL;
+
+			(void)sizeof(align_must_be_a_power_of_two);
+			if (n > max_size())
+				throw std::bad_alloc();
+			if (posix_memalign(&p, Align, n * sizeof(T) == 0 ? Align : n * sizeof(T)) != 0)
+				throw std::bad_alloc();
+			return (static_cast<pointer>(p));
+		}
+
+		void deallocate (pointer p, size_type)
+		{
+			std::free(p);
+		}
+
+		void construct (pointer p, const_reference val)
+		{
+			new (static_cast<void*>(p)) T(val);
+		}
+
+#ifdef FT_CXX11
+		template <class U, class... Args>
+		void construct (U* p, Args&&... args)
+		{
+			new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+		}
+#endif
+
+		void destroy (pointer p)
+		{
+			p->~T();
+		}
+	};
+
+	template <class T, size_t Align>
+	struct allocation_granularity<aligned_allocator<T, Align> >
+	{
+		static const size_t value = Align;
+	};
+
+	template <class T, size_t Align, class U>
+	bool operator== (const aligned_allocator<T, Align>&, const aligned_allocator<U, Align>&)
+	{
+		return (true);
+	}
+
+	template <class T, size_t Align, class U>
+	bool operator!= (const aligned_allocator<T, Align>&, const aligned_allocator<U, Align>&)
+	{
+		return (false);
+	}
+}
+
+#endif
@@ -0,0 +1,364 @@
+#pragma once
+#ifndef CONCURRENT_STACK_HPP
+#define CONCURRENT_STACK_HPP
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include "utils.hpp"
+
+namespace ft
+{
+	/*
+	** Lock-free LIFO for any number of pushing and popping threads (Treiber
+	** stack). Elements sit in nodes taken from a pool of chunks that double in
+	** size and are never handed back before the stack is destroyed, so a
+	** thread that still holds a node that another thread popped meanwhile
+	** reads valid, if stale, memory. Nodes are named by 32-bit indices; the
+	** head is an index plus a tag bumped by every change, so one 64-bit CAS
+	** both moves the head and tells a recycled node from the one a slow
+	** thread saw (ABA). Popped nodes go to a free list built the same way.
+	** Under contention a push or pop that loses the CAS tries the elimination
+	** array: a pusher posts its node in a slot and waits a little, a popper
+	** takes a posted node there, and the pair completes without touching the
+	** head.
+	*/
+	template <class T, class Alloc = std::allocator<T> >
+	class concurrent_stack
+	{
+	public:
+		typedef T									value_type;
+		typedef Alloc								allocator_type;
+		typedef typename allocator_type::pointer	pointer;
+		typedef size_t								size_type;
+	private:
+		typedef unsigned int		index_type;
+		typedef unsigned long long	word;
+
+		struct node
+		{
+			index_type	next;
+			index_type	generation;
+		};
+
+		/*
+		** A word alone on its cache line, so the heads and slots do not slow
+		** each other. The alignment carries over to concurrent_stack itself:
+		** locals and statics get it, but before C++17 operator new only
+		** guarantees alignof(max_align_t), so a concurrent_stack on the heap
+		** must come from an aligned_allocator or placement new into aligned
+		** storage.
+		*/
+		struct line
+		{
+			word	value;
+			char	pad[64 - sizeof(word)];
+		} __attribute__((aligned(64)));
+
+		typedef typename allocator_type::template rebind<node>::other	node_allocator;
+
+		static const index_type	nil = 0xffffffffu;
+		static const size_t		first_chunk = 64;
+		static const size_t		max_chunks = 25;
+		static const size_t		slots = 8;
+		static const int		patience = 128;
+
+		line			_slots[slots];
+		line			_head;
+		line			_free;
+		size_t			_fresh;
+		allocator_type	_alloc;
+		node_allocator	_node_alloc;
+		pointer			_values[max_chunks];
+		node			*_nodes[max_chunks];
+
+		concurrent_stack (const concurrent_stack&);
+		concurrent_stack& operator= (const concurrent_stack&);
+
+		static index_type index_of (word w)
+		{
+			return ((index_type)w);
+		}
+
+		static word make_word (index_type i, word tag)
+		{
+			return ((tag << 32) | i);
+		}
+
+		static word next_word (word old, index_type i)
+		{
+			return (make_word(i, (old >> 32) + 1));
+		}
+
+		static void relax()
+		{
+#if defined(__i386__) || defined(__x86_64__)
+			__builtin_ia32_pause();
+#endif
+		}
+
+		/* Chunk c holds first_chunk << c nodes and starts at first_chunk * (2^c - 1). */
+		static size_t chunk_of (size_t i)
+		{
+			return (63 - __builtin_clzll(i / first_chunk + 1));
+		}
+
+		static size_t chunk_start (size_t c)
+		{
+			return (first_chunk * ((size_t(1) << c) - 1));
+		}
+
+		static size_t max_nodes()
+		{
+			return (chunk_start(max_chunks));
+		}
+
+		/* Installs a chunk unless another thread got there first. */
+		template <class A, class P>
+		static void publish (A& alloc, P *at, size_t n)
+		{
+			if (__atomic_load_n(at, __ATOMIC_ACQUIRE) != NULL)
+				return ;
+			P fresh = alloc.allocate(n);
+			P expected = NULL;
+			if (!__atomic_compare_exchange_n(at, &expected, fresh, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+				alloc.deallocate(fresh, n);
+		}
+
+		void ensure_chunk (size_t c)
+		{
+			publish(_alloc, &_values[c], first_chunk << c);
+			publish(_node_alloc, &_nodes[c], first_chunk << c);
+		}
+
+		node& node_at (index_type i) const
+		{
+			size_t c = chunk_of(i);
+			return (__atomic_load_n(&_nodes[c], __ATOMIC_ACQUIRE)[i - chunk_start(c)]);
+		}
+
+		pointer value_at (index_type i) const
+		{
+			size_t c = chunk_of(i);
+			return (__atomic_load_n(&_values[c], __ATOMIC_ACQUIRE) + (i - chunk_start(c)));
+		}
+
+		bool push_index (word *head, index_type i)
+		{
+			word old = __atomic_load_n(head, __ATOMIC_RELAXED);
+
+			__atomic_store_n(&node_at(i).next, index_of(old), __ATOMIC_RELAXED);
+			return (__atomic_compare_exchange_n(head, &old, next_word(old, i), false, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+		}
+
+		/* False when the CAS was lost; i is nil when the list was empty. */
+		bool pop_index (word *head, index_type& i)
+		{
+			word old = __atomic_load_n(head, __ATOMIC_ACQUIRE);
+
+			i = index_of(old);
+			if (i == nil)
+				return (true);
+			index_type next = __atomic_load_n(&node_at(i).next, __ATOMIC_RELAXED);
+			return (__atomic_compare_exchange_n(head, &old, next_word(old, next), false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED));
+		}
+
+		void push_free (index_type i)
+		{
+			while (!push_index(&_free.value, i))
+				relax();
+		}
+
+		index_type allocate_node()
+		{
+			index_type i;
+
+			while (!pop_index(&_free.value, i))
+				relax();
+			if (i == nil)
+			{
+				size_t n = __atomic_fetch_add(&_fresh, 1, __ATOMIC_RELAXED);
+				if (n >= max_nodes())
+					throw std::length_error("concurrent_stack: too many elements");
+				i = (index_type)n;
+				ensure_chunk(chunk_of(i));
+			}
+			node_at(i).generation++;
+			return (i);
+		}
+
+		/* Spreads the threads over the slots; attempt moves a retry to another one. */
+		word& pick_slot (unsigned attempt)
+		{
+			char	here;
+			word	hash = (word)(size_t)&here * 0x9E3779B97F4A7C15ull;
+
+			return (_slots[((hash >> 60) + attempt) % slots].value);
+		}
+
+		/* True when a popper took node i from the slot. */
+		bool eliminate_push (index_type i, unsigned attempt)
+		{
+			word	&posted = pick_slot(attempt);
+			word	mine = ((word)node_at(i).generation << 32) | (i + 1);
+			word	expected = 0;
+
+			if (!__atomic_compare_exchange_n(&posted, &expected, mine, false, __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+				return (false);
+			for (int n = 0; n != patience; n++)
+			{
+				if (__atomic_load_n(&posted, __ATOMIC_RELAXED) != mine)
+					return (true);
+				relax();
+			}
+			return (!__atomic_compare_exchange_n(&posted, &mine, 0, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+		}
+
+		bool eliminate_pop (index_type& i, unsigned attempt)
+		{
+			word	&slot = pick_slot(attempt);
+
+			for (int n = 0; n != patience; n++)
+			{
+				word posted = __atomic_load_n(&slot, __ATOMIC_RELAXED);
+				if (posted != 0 && __atomic_compare_exchange_n(&slot, &posted, 0, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+				{
+					i = (index_type)posted - 1;
+					return (true);
+				}
+				if (index_of(__atomic_load_n(&_head.value, __ATOMIC_RELAXED)) == nil)
+					return (false);
+				relax();
+			}
+			return (false);
+		}
+
+		void link (index_type i)
+		{
+			for (unsigned attempt = 0; !push_index(&_head.value, i); attempt++)
+				if (eliminate_push(i, attempt))
+					return ;
+		}
+
+		index_type unlink()
+		{
+			index_type i;
+
+			for (unsigned attempt = 0; !pop_index(&_head.value, i); attempt++)
+				if (eliminate_pop(i, attempt))
+					return (i);
+			return (i);
+		}
+	public:
+		explicit concurrent_stack (const allocator_type& alloc = allocator_type()) :
+			_fresh(0), _alloc(alloc), _node_alloc(alloc)
+		{
+			_head.value = make_word(nil, 0);
+			_free.value = make_word(nil, 0);
+			for (size_t s = 0; s != slots; s++)
+				_slots[s].value = 0;
+			for (size_t c = 0; c != max_chunks; c++)
+			{
+				_values[c] = NULL;
+				_nodes[c] = NULL;
+			}
+		}
+
+		/* No other thread may use the stack any more. */
+		~concurrent_stack()
+		{
+			for (index_type i = index_of(_head.value); i != nil; i = node_at(i).next)
+				_alloc.destroy(value_at(i));
+			for (size_t c = 0; c != max_chunks; c++)
+			{
+				if (_values[c] != NULL)
+					_alloc.deallocate(_values[c], first_chunk << c);
+				if (_nodes[c] != NULL)
+					_node_alloc.deallocate(_nodes[c], first_chunk << c);
+			}
+		}
+
+		allocator_type get_allocator() const
+		{
+			return (_alloc);
+		}
+
+		/* A snapshot: another thread may push or pop right after. */
+		bool empty() const
+		{
+			return (index_of(__atomic_load_n(&_head.value, __ATOMIC_ACQUIRE)) == nil);
+		}
+
+		/* Allocates the pool chunks for n nodes, so the first n pushes do not allocate. */
+		void reserve (size_type n)
+		{
+			if (n > max_nodes())
+				throw std::length_error("concurrent_stack: too many elements");
+			for (size_t c = 0; c != max_chunks && chunk_start(c) < n; c++)
+				ensure_chunk(c);
+		}
+
+		void push (const value_type& val)
+		{
+			index_type i = allocate_node();
+
+			try
+			{
+				_alloc.construct(value_at(i), val);
+			}
+			catch (...)
+			{
+				push_free(i);
+				throw ;
+			}
+			link(i);
+		}
+
+#ifdef FT_CXX11
+		void push (value_type&& val)
+		{
+			index_type i = allocate_node();
+
+			try
+			{
+				_alloc.construct(value_at(i), std::move(val));
+			}
+			catch (...)
+			{
+				push_free(i);
+				throw ;
+			}
+			link(i);
+		}
+#endif
+
+		/*
+		** Moves the top element into out and returns true, or returns false
+		** when the stack was empty. If assigning to out throws, the element is
+		** dropped.
+		*/
+		bool try_pop (value_type& out)
+		{
+			index_type i = unlink();
+
+			if (i == nil)
+				return (false);
+			pointer p = value_at(i);
+			try
+			{
+				out = FT_MOVE(*p);
+			}
+			catch (...)
+			{
+				_alloc.destroy(p);
+				push_free(i);
+				throw ;
+			}
+			_alloc.destroy(p);
+			push_free(i);
+			return (true);
+		}
+	};
+}
+
+#endif
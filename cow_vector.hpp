@@ -0,0 +1,465 @@
+#pragma once
+#ifndef COW_VECTOR_HPP
+#define COW_VECTOR_HPP
+
+#include <algorithm>
+#include <memory>
+#include <new>
+#include "vector.hpp"
+
+namespace ft
+{
+	/*
+	** Copy-on-write vector: copies share one buffer and its reference count,
+	** so a copy costs an atomic increment; the first mutation through a copy
+	** that is still shared gives it a private buffer first. Element access
+	** and iterators are read-only, so reading a snapshot never copies it,
+	** const or not. Writes go through set() and the modifiers; edit() hands
+	** out the underlying vector for writing in place, which detaches and
+	** marks the buffer unshareable, as the caller may keep references: copies
+	** made after that are deep, until clear(), assign() or operator=
+	** invalidate them. Distinct cow_vector objects may be used from
+	** different threads even while they share a buffer.
+	*/
+	template <class T, class Alloc = std::allocator<T> >
+	class cow_vector
+	{
+	public:
+		typedef ft::vector<T, Alloc>								vector_type;
+		typedef T													value_type;
+		typedef Alloc												allocator_type;
+		typedef typename vector_type::reference						reference;
+		typedef typename vector_type::const_reference				const_reference;
+		typedef typename vector_type::pointer						pointer;
+		typedef typename vector_type::const_pointer					const_pointer;
+		typedef typename vector_type::const_iterator				iterator;
+		typedef typename vector_type::const_iterator				const_iterator;
+		typedef typename vector_type::const_reverse_iterator		reverse_iterator;
+		typedef typename vector_type::const_reverse_iterator		const_reverse_iterator;
+		typedef typename vector_type::difference_type				difference_type;
+		typedef typename vector_type::size_type						size_type;
+	private:
+		struct rep
+		{
+			long			refs;
+			bool			shareable;
+			vector_type		data;
+
+			explicit rep (const allocator_type& alloc) : refs(1), shareable(true), data(alloc) {}
+			rep (const rep& x) : refs(1), shareable(true), data(x.data) {}
+		};
+
+		typedef typename allocator_type::template rebind<rep>::other	rep_allocator;
+
+		/*
+		** The empty rep moved-from cow_vectors point at. It holds a reference
+		** of its own, so it is never freed, and it is built in static storage
+		** so that taking it cannot throw after the first call.
+		*/
+		static rep* empty_rep()
+		{
+			static char	storage[sizeof(rep)] __attribute__((aligned(__alignof__(rep))));
+			static rep	*empty = new (storage) rep(allocator_type());
+
+			return (empty);
+		}
+
+		rep_allocator	_rep_alloc;
+		rep				*_rep;
+
+		rep* make_rep (const rep& x)
+		{
+			rep *p = _rep_alloc.allocate(1);
+			try
+			{
+				_rep_alloc.construct(p, x);
+			}
+			catch (...)
+			{
+				_rep_alloc.deallocate(p, 1);
+				throw ;
+			}
+			return (p);
+		}
+
+		void release()
+		{
+			if (__atomic_sub_fetch(&_rep->refs, 1, __ATOMIC_ACQ_REL) == 0)
+			{
+				_rep_alloc.destroy(_rep);
+				_rep_alloc.deallocate(_rep, 1);
+			}
+		}
+
+		/* Shares x's buffer, or copies it when it has leaked references. */
+		rep* acquire (rep *x)
+		{
+			if (!x->shareable)
+				return (make_rep(*x));
+			__atomic_add_fetch(&x->refs, 1, __ATOMIC_RELAXED);
+			return (x);
+		}
+
+		/* Gives this object a buffer nobody else sees before it is written. */
+		vector_type& mutate()
+		{
+			if (__atomic_load_n(&_rep->refs, __ATOMIC_ACQUIRE) != 1)
+			{
+				rep *own = make_rep(*_rep);
+				release();
+				_rep = own;
+			}
+			return (_rep->data);
+		}
+
+		/* mutate() for accessors whose result outlives the call. */
+		vector_type& leak()
+		{
+			vector_type &data = mutate();
+			_rep->shareable = false;
+			return (data);
+		}
+
+		/* Only for operations that invalidate every reference into the buffer. */
+		vector_type& reset()
+		{
+			vector_type &data = mutate();
+			_rep->shareable = true;
+			return (data);
+		}
+	public:
+		explicit cow_vector (const allocator_type& alloc = allocator_type()) : _rep_alloc(alloc)
+		{
+			_rep = make_rep(rep(alloc));
+		}
+
+		explicit cow_vector (size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type()) :
+			_rep_alloc(alloc)
+		{
+			_rep = make_rep(rep(alloc));
+			try
+			{
+				_rep->data.assign(n, val);
+			}
+			catch (...)
+			{
+				release();
+				throw ;
+			}
+		}
+
+		template <class InputIterator>
+		cow_vector (InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL) :
+			_rep_alloc(alloc)
+		{
+			_rep = make_rep(rep(alloc));
+			try
+			{
+				_rep->data.assign(first, last);
+			}
+			catch (...)
+			{
+				release();
+				throw ;
+			}
+		}
+
+		cow_vector (const cow_vector& x) : _rep_alloc(x._rep_alloc)
+		{
+			_rep = acquire(x._rep);
+		}
+
+		/* Starts out sole owner of a copy of x. */
+		explicit cow_vector (const vector_type& x) : _rep_alloc(x.get_allocator())
+		{
+			_rep = make_rep(rep(x.get_allocator()));
+			try
+			{
+				_rep->data = x;
+			}
+			catch (...)
+			{
+				release();
+				throw ;
+			}
+		}
+
+		cow_vector& operator= (const cow_vector& x)
+		{
+			if (_rep != x._rep)
+			{
+				rep *shared = acquire(x._rep);
+				release();
+				_rep = shared;
+			}
+			return (*this);
+		}
+
+#ifdef FT_CXX11
+		cow_vector (cow_vector&& x) noexcept : _rep_alloc(x._rep_alloc), _rep(x._rep)
+		{
+			x._rep = empty_rep();
+			__atomic_add_fetch(&x._rep->refs, 1, __ATOMIC_RELAXED);
+		}
+
+		cow_vector& operator= (cow_vector&& x) noexcept
+		{
+			swap(x);
+			return (*this);
+		}
+#endif
+
+		~cow_vector()
+		{
+			release();
+		}
+
+		/* Number of cow_vectors sharing the buffer (1 when it is private). */
+		long use_count() const
+		{
+			return (__atomic_load_n(&_rep->refs, __ATOMIC_ACQUIRE));
+		}
+
+		bool unique() const
+		{
+			return (use_count() == 1);
+		}
+
+		/* The buffer, read-only; never copies. */
+		const vector_type& get() const
+		{
+			return (_rep->data);
+		}
+
+		size_type size() const
+		{
+			return (_rep->data.size());
+		}
+
+		size_type capacity() const
+		{
+			return (_rep->data.capacity());
+		}
+
+		size_type max_size() const
+		{
+			return (_rep->data.max_size());
+		}
+
+		bool empty() const
+		{
+			return (_rep->data.empty());
+		}
+
+		allocator_type get_allocator() const
+		{
+			return (_rep->data.get_allocator());
+		}
+
+		const_iterator begin() const
+		{
+			return (get().begin());
+		}
+
+		const_iterator end() const
+		{
+			return (get().end());
+		}
+
+		const_reverse_iterator rbegin() const
+		{
+			return (get().rbegin());
+		}
+
+		const_reverse_iterator rend() const
+		{
+			return (get().rend());
+		}
+
+		const_reference operator[] (size_type n) const
+		{
+			return (get()[n]);
+		}
+
+		const_reference at (size_type n) const
+		{
+			if (n >= size())
+				throw std::out_of_range("cow_vector::at");
+			return (get()[n]);
+		}
+
+		const_reference front() const
+		{
+			return (get().front());
+		}
+
+		const_reference back() const
+		{
+			return (get().back());
+		}
+
+		const_pointer data() const
+		{
+			return (get().data());
+		}
+
+		/*
+		** The buffer, for writing in place. The buffer stops being shared,
+		** now and by later copies, until clear(), assign() or operator=.
+		*/
+		vector_type& edit()
+		{
+			return (leak());
+		}
+
+		/* Writes element n without handing out a reference, so the buffer stays shareable. */
+		void set (size_type n, const value_type& val)
+		{
+			if (n >= size())
+				throw std::out_of_range("cow_vector::set");
+			mutate()[n] = val;
+		}
+
+		void reserve (size_type n)
+		{
+			if (n > capacity())
+				mutate().reserve(n);
+		}
+
+		void shrink_to_fit()
+		{
+			if (capacity() != size())
+				mutate().shrink_to_fit();
+		}
+
+		void resize (size_type n, value_type val = value_type())
+		{
+			mutate().resize(n, val);
+		}
+
+		void push_back (const value_type& val)
+		{
+			mutate().push_back(val);
+		}
+
+		void pop_back()
+		{
+			mutate().pop_back();
+		}
+
+		/* Positions are taken as offsets, since detaching moves the elements. */
+		iterator insert (const_iterator position, const value_type& val)
+		{
+			difference_type offset = position - begin();
+			vector_type		&data = mutate();
+			return (data.insert(data.begin() + offset, val));
+		}
+
+		void insert (const_iterator position, size_type n, const value_type& val)
+		{
+			difference_type offset = position - begin();
+			vector_type		&data = mutate();
+			data.insert(data.begin() + offset, n, val);
+		}
+
+		template <class InputIterator>
+		void insert (const_iterator position, InputIterator first, InputIterator last,
+					 typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL)
+		{
+			difference_type offset = position - begin();
+			vector_type		&data = mutate();
+			data.insert(data.begin() + offset, first, last);
+		}
+
+		iterator erase (const_iterator position)
+		{
+			difference_type offset = position - begin();
+			vector_type		&data = mutate();
+			return (data.erase(data.begin() + offset));
+		}
+
+		iterator erase (const_iterator first, const_iterator last)
+		{
+			difference_type offset = first - begin();
+			difference_type count = last - first;
+			vector_type		&data = mutate();
+			return (data.erase(data.begin() + offset, data.begin() + offset + count));
+		}
+
+		template <class InputIterator>
+		void assign (InputIterator first, InputIterator last,
+					 typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL)
+		{
+			vector_type tmp(first, last, get_allocator());
+			reset().swap(tmp);
+		}
+
+		void assign (size_type n, const value_type& val)
+		{
+			vector_type tmp(n, val, get_allocator());
+			reset().swap(tmp);
+		}
+
+		void clear()
+		{
+			if (unique())
+				reset().clear();
+			else
+			{
+				cow_vector tmp(get_allocator());
+				swap(tmp);
+			}
+		}
+
+		void swap (cow_vector& x)
+		{
+			std::swap(_rep_alloc, x._rep_alloc);
+			std::swap(_rep, x._rep);
+		}
+	};
+
+	template <class T, class Alloc>
+	void swap (cow_vector<T, Alloc>& x, cow_vector<T, Alloc>& y)
+	{
+		x.swap(y);
+	}
+
+	template <class T, class Alloc>
+	bool operator== (const cow_vector<T, Alloc>& lhs, const cow_vector<T, Alloc>& rhs)
+	{
+		return (lhs.get() == rhs.get());
+	}
+
+	template <class T, class Alloc>
+	bool operator!= (const cow_vector<T, Alloc>& lhs, const cow_vector<T, Alloc>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template <class T, class Alloc>
+	bool operator< (const cow_vector<T, Alloc>& lhs, const cow_vector<T, Alloc>& rhs)
+	{
+		return (lhs.get() < rhs.get());
+	}
+
+	template <class T, class Alloc>
+	bool operator<= (const cow_vector<T, Alloc>& lhs, const cow_vector<T, Alloc>& rhs)
+	{
+		return (!(rhs < lhs));
+	}
+
+	template <class T, class Alloc>
+	bool operator> (const cow_vector<T, Alloc>& lhs, const cow_vector<T, Alloc>& rhs)
+	{
+		return (rhs < lhs);
+	}
+
+	template <class T, class Alloc>
+	bool operator>= (const cow_vector<T, Alloc>& lhs, const cow_vector<T, Alloc>& rhs)
+	{
+		return (!(lhs < rhs));
+	}
+}
+
+#endif
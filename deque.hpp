@@ -0,0 +1,745 @@
+#pragma once
+#ifndef DEQUE_HPP
+#define DEQUE_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include "iterator.hpp"
+#include "utils.hpp"
+
+namespace ft
+{
+	/* Elements per block: 4KB worth, and at least 16. */
+	template <class T>
+	struct deque_block_size
+	{
+		static const size_t value = (sizeof(T) <= 4096 / 16 ? 4096 / sizeof(T) : 16);
+	};
+
+	/*
+	** Walks the blocks of an ft::deque: _cur is the element, [_first, _last)
+	** the block holding it and _node its slot in the block map.
+	*/
+	template <class T>
+	class deque_iterator : public iterator<std::random_access_iterator_tag, T>
+	{
+	public:
+		typedef typename iterator<std::random_access_iterator_tag, T>::value_type			value_type;
+		typedef typename iterator<std::random_access_iterator_tag, T>::difference_type		difference_type;
+		typedef typename iterator<std::random_access_iterator_tag, T>::iterator_category	iterator_category;
+		typedef T*																			pointer;
+		typedef T&																			reference;
+		typedef typename ft::remove_const<T>::type**										map_pointer;
+
+		static const difference_type	block = deque_block_size<typename ft::remove_const<T>::type>::value;
+
+		pointer		_cur;
+		pointer		_first;
+		pointer		_last;
+		map_pointer	_node;
+
+		deque_iterator() : _cur(NULL), _first(NULL), _last(NULL), _node(NULL) {}
+		deque_iterator(pointer cur, map_pointer node) : _cur(cur), _first(*node), _last(*node + block), _node(node) {}
+
+		void set_node (map_pointer node)
+		{
+			_node = node;
+			_first = *node;
+			_last = _first + block;
+		}
+
+		reference operator*() const
+		{
+			return (*_cur);
+		}
+
+		pointer operator->() const
+		{
+			return (_cur);
+		}
+
+		deque_iterator& operator++()
+		{
+			if (++_cur == _last)
+			{
+				set_node(_node + 1);
+				_cur = _first;
+			}
+			return (*this);
+		}
+
+		deque_iterator operator++(int)
+		{
+			deque_iterator tmp(*this);
+			++*this;
+			return (tmp);
+		}
+
+		deque_iterator& operator--()
+		{
+			if (_cur == _first)
+			{
+				set_node(_node - 1);
+				_cur = _last;
+			}
+			--_cur;
+			return (*this);
+		}
+
+		deque_iterator operator--(int)
+		{
+			deque_iterator tmp(*this);
+			--*this;
+			return (tmp);
+		}
+
+		deque_iterator& operator+=(difference_type n)
+		{
+			difference_type offset = n + (_cur - _first);
+			if (offset >= 0 && offset < block)
+				_cur += n;
+			else
+			{
+				difference_type node_offset = (offset > 0 ? offset / block : -((-offset - 1) / block) - 1);
+				set_node(_node + node_offset);
+				_cur = _first + (offset - node_offset * block);
+			}
+			return (*this);
+		}
+
+		deque_iterator& operator-=(difference_type n)
+		{
+			return (*this += -n);
+		}
+
+		deque_iterator operator+(difference_type n) const
+		{
+			deque_iterator tmp(*this);
+			return (tmp += n);
+		}
+
+		friend deque_iterator operator+(difference_type n, const deque_iterator& it)
+		{
+			return (it + n);
+		}
+
+		deque_iterator operator-(difference_type n) const
+		{
+			deque_iterator tmp(*this);
+			return (tmp -= n);
+		}
+
+		friend difference_type operator-(const deque_iterator& lco, const deque_iterator& rco)
+		{
+			if (lco._node == rco._node)
+				return (lco._cur - rco._cur);
+			return (block * (lco._node - rco._node - 1) + (lco._cur - lco._first) + (rco._last - rco._cur));
+		}
+
+		reference operator[](difference_type n) const
+		{
+			return (*(*this + n));
+		}
+
+		friend bool operator==(const deque_iterator& lco, const deque_iterator& rco)
+		{
+			return (lco._cur == rco._cur);
+		}
+
+		friend bool operator!=(const deque_iterator& lco, const deque_iterator& rco)
+		{
+			return (lco._cur != rco._cur);
+		}
+
+		friend bool operator<(const deque_iterator& lco, const deque_iterator& rco)
+		{
+			return (lco._node == rco._node ? lco._cur < rco._cur : lco._node < rco._node);
+		}
+
+		friend bool operator>(const deque_iterator& lco, const deque_iterator& rco)
+		{
+			return (rco < lco);
+		}
+
+		friend bool operator<=(const deque_iterator& lco, const deque_iterator& rco)
+		{
+			return (!(rco < lco));
+		}
+
+		friend bool operator>=(const deque_iterator& lco, const deque_iterator& rco)
+		{
+			return (!(lco < rco));
+		}
+
+		operator deque_iterator<const T>() const
+		{
+			deque_iterator<const T> it;
+
+			it._cur = _cur;
+			it._first = _first;
+			it._last = _last;
+			it._node = _node;
+			return (it);
+		}
+	};
+
+	/*
+	** Double-ended queue stored as fixed-size blocks listed in a block map.
+	** Pushing at either end never moves an element: it at most allocates a
+	** block and, rarely, copies the map of block pointers. References to
+	** elements stay valid until those elements are erased; iterators are
+	** invalidated by any push, as with std::deque. A map slot that is not
+	** NULL owns its block. One emptied block is kept past each end so that
+	** a size oscillating around a block boundary does not allocate on every
+	** step; blocks further out are freed on the way down.
+	*/
+	template <class T, class Alloc = std::allocator<T> >
+	class deque
+	{
+	public:
+		typedef T														value_type;
+		typedef Alloc													allocator_type;
+		typedef typename allocator_type::reference						reference;
+		typedef typename allocator_type::const_reference				const_reference;
+		typedef typename allocator_type::pointer						pointer;
+		typedef typename allocator_type::const_pointer					const_pointer;
+		typedef ft::deque_iterator<value_type>							iterator;
+		typedef ft::deque_iterator<const value_type>					const_iterator;
+		typedef ft::reverse_iterator<iterator>							reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>					const_reverse_iterator;
+		typedef typename ft::iterator_traits<iterator>::difference_type	difference_type;
+		typedef typename allocator_type::size_type						size_type;
+	private:
+		typedef typename iterator::map_pointer							map_pointer;
+		typedef typename allocator_type::template rebind<pointer>::other	map_allocator_type;
+		typedef ft::is_integral_res<bool, ft::is_trivially_copyable<value_type>::value>		trivial_tag;
+
+		static const size_type	_block = deque_block_size<value_type>::value;
+
+		allocator_type		_alloc;
+		map_allocator_type	_map_alloc;
+		map_pointer			_map;
+		size_type			_map_size;
+		iterator			_start;
+		iterator			_finish;
+
+		void initialize_map()
+		{
+			_map_size = 8;
+			_map = _map_alloc.allocate(_map_size);
+			std::memset(static_cast<void*>(_map), 0, _map_size * sizeof(pointer));
+			map_pointer node = _map + (_map_size - 1) / 2;
+			*node = _alloc.allocate(_block);
+			_start.set_node(node);
+			_start._cur = _start._first + _block / 2;
+			_finish = _start;
+		}
+
+		/* Frees the block in slot node, if there is one. */
+		void release_block (map_pointer node)
+		{
+			if (node >= _map && node < _map + _map_size && *node != NULL)
+			{
+				_alloc.deallocate(*node, _block);
+				*node = NULL;
+			}
+		}
+
+		/* Frees every block outside [first, last]. */
+		void release_blocks_outside (map_pointer first, map_pointer last)
+		{
+			for (map_pointer node = _map; node != first; node++)
+				release_block(node);
+			for (map_pointer node = last + 1; node < _map + _map_size; node++)
+				release_block(node);
+		}
+
+		/*
+		** Makes room for nodes more slots before or after the used ones: the
+		** used slots are recentered in the map when it is less than half
+		** full, otherwise the map grows. Spare blocks are given back first.
+		*/
+		void reallocate_map (size_type nodes, bool at_front)
+		{
+			size_type	old_nodes = _finish._node - _start._node + 1;
+			size_type	new_nodes = old_nodes + nodes;
+			map_pointer	new_start;
+
+			release_blocks_outside(_start._node, _finish._node);
+			if (_map_size > 2 * new_nodes)
+			{
+				new_start = _map + (_map_size - new_nodes) / 2 + (at_front ? nodes : 0);
+				std::memmove(static_cast<void*>(new_start), static_cast<const void*>(_start._node), old_nodes * sizeof(pointer));
+				std::memset(static_cast<void*>(_map), 0, (new_start - _map) * sizeof(pointer));
+				std::memset(static_cast<void*>(new_start + old_nodes), 0, (_map + _map_size - new_start - old_nodes) * sizeof(pointer));
+			}
+			else
+			{
+				size_type	new_size = _map_size + (_map_size > nodes ? _map_size : nodes) + 2;
+				map_pointer	new_map = _map_alloc.allocate(new_size);
+
+				std::memset(static_cast<void*>(new_map), 0, new_size * sizeof(pointer));
+				new_start = new_map + (new_size - new_nodes) / 2 + (at_front ? nodes : 0);
+				std::memcpy(static_cast<void*>(new_start), static_cast<const void*>(_start._node), old_nodes * sizeof(pointer));
+				_map_alloc.deallocate(_map, _map_size);
+				_map = new_map;
+				_map_size = new_size;
+			}
+			_start.set_node(new_start);
+			_finish.set_node(new_start + old_nodes - 1);
+		}
+
+		/* Makes sure the slot after _finish lives in an allocated block. */
+		void grow_back()
+		{
+			if (_map == NULL)
+			{
+				initialize_map();
+				return ;
+			}
+			if (_finish._node + 2 > _map + _map_size)
+				reallocate_map(1, false);
+			if (_finish._node[1] == NULL)
+				_finish._node[1] = _alloc.allocate(_block);
+		}
+
+		/* Makes sure the slot before _start lives in an allocated block. */
+		void grow_front()
+		{
+			if (_map == NULL)
+			{
+				initialize_map();
+				return ;
+			}
+			if (_start._node == _map)
+				reallocate_map(1, true);
+			if (_start._node[-1] == NULL)
+				_start._node[-1] = _alloc.allocate(_block);
+		}
+
+		void destroy_range (iterator first, iterator last)
+		{
+			destroy_range(first, last, trivial_tag());
+		}
+
+		void destroy_range (iterator, iterator, ft::true_type) {}
+
+		void destroy_range (iterator first, iterator last, ft::false_type)
+		{
+			for (; first != last; ++first)
+				_alloc.destroy(first._cur);
+		}
+
+		void fill_back (size_type n, const value_type& val)
+		{
+			for (; n != 0; n--)
+				push_back(val);
+		}
+
+		template <class InputIterator>
+		size_type append (InputIterator first, InputIterator last)
+		{
+			size_type n = 0;
+
+			for (; first != last; first++, n++)
+				push_back(*first);
+			return (n);
+		}
+	public:
+		explicit deque (const allocator_type& alloc = allocator_type()) :
+			_alloc(alloc), _map_alloc(alloc), _map(NULL), _map_size(0), _start(), _finish() {}
+
+		explicit deque (size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type()) :
+			_alloc(alloc), _map_alloc(alloc), _map(NULL), _map_size(0), _start(), _finish()
+		{
+			fill_back(n, val);
+		}
+
+		template <class InputIterator>
+		deque (InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
+			   typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL) :
+			_alloc(alloc), _map_alloc(alloc), _map(NULL), _map_size(0), _start(), _finish()
+		{
+			append(first, last);
+		}
+
+		deque (const deque& x) :
+			_alloc(x._alloc), _map_alloc(x._map_alloc), _map(NULL), _map_size(0), _start(), _finish()
+		{
+			append(x.begin(), x.end());
+		}
+
+		deque& operator= (const deque& x)
+		{
+			if (this == &x)
+				return (*this);
+			clear();
+			append(x.begin(), x.end());
+			return (*this);
+		}
+
+#ifdef FT_CXX11
+		deque (deque&& x) noexcept :
+			_alloc(x._alloc), _map_alloc(x._map_alloc), _map(NULL), _map_size(0), _start(), _finish()
+		{
+			swap(x);
+		}
+
+		deque& operator= (deque&& x) noexcept
+		{
+			if (this != &x)
+			{
+				deque tmp(std::move(x));
+				swap(tmp);
+			}
+			return (*this);
+		}
+#endif
+
+		~deque()
+		{
+			if (_map == NULL)
+				return ;
+			destroy_range(_start, _finish);
+			for (size_type i = 0; i != _map_size; i++)
+				if (_map[i] != NULL)
+					_alloc.deallocate(_map[i], _block);
+			_map_alloc.deallocate(_map, _map_size);
+		}
+
+		iterator begin()
+		{
+			return (_start);
+		}
+
+		const_iterator begin() const
+		{
+			return (_start);
+		}
+
+		iterator end()
+		{
+			return (_finish);
+		}
+
+		const_iterator end() const
+		{
+			return (_finish);
+		}
+
+		reverse_iterator rbegin()
+		{
+			return (reverse_iterator(end()));
+		}
+
+		const_reverse_iterator rbegin() const
+		{
+			return (const_reverse_iterator(end()));
+		}
+
+		reverse_iterator rend()
+		{
+			return (reverse_iterator(begin()));
+		}
+
+		const_reverse_iterator rend() const
+		{
+			return (const_reverse_iterator(begin()));
+		}
+
+		size_type size() const
+		{
+			return (_finish - _start);
+		}
+
+		size_type max_size() const
+		{
+			return (_alloc.max_size());
+		}
+
+		bool empty() const
+		{
+			return (_start == _finish);
+		}
+
+		void resize (size_type n, value_type val = value_type())
+		{
+			while (size() > n)
+				pop_back();
+			fill_back(n - size(), val);
+		}
+
+		/* Gives back the spare blocks past both ends. */
+		void shrink_to_fit()
+		{
+			if (_map != NULL)
+				release_blocks_outside(_start._node, _finish._node);
+		}
+
+		reference operator[] (size_type n)
+		{
+			size_type offset = n + (_start._cur - _start._first);
+			return (_start._node[offset / _block][offset % _block]);
+		}
+
+		const_reference operator[] (size_type n) const
+		{
+			size_type offset = n + (_start._cur - _start._first);
+			return (_start._node[offset / _block][offset % _block]);
+		}
+
+		reference at (size_type n)
+		{
+			if (n >= size())
+				throw std::out_of_range("deque::at");
+			return ((*this)[n]);
+		}
+
+		const_reference at (size_type n) const
+		{
+			if (n >= size())
+				throw std::out_of_range("deque::at");
+			return ((*this)[n]);
+		}
+
+		reference front()
+		{
+			return (*_start);
+		}
+
+		const_reference front() const
+		{
+			return (*_start);
+		}
+
+		reference back()
+		{
+			iterator tmp(_finish);
+			return (*--tmp);
+		}
+
+		const_reference back() const
+		{
+			iterator tmp(_finish);
+			return (*--tmp);
+		}
+
+		template <class InputIterator>
+		void assign (InputIterator first, InputIterator last,
+					 typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL)
+		{
+			clear();
+			append(first, last);
+		}
+
+		void assign (size_type n, const value_type& val)
+		{
+			clear();
+			fill_back(n, val);
+		}
+
+		void push_back (const value_type& val)
+		{
+			if (_finish._last - _finish._cur <= 1)
+				grow_back();
+			_alloc.construct(_finish._cur, val);
+			++_finish;
+		}
+
+		void push_front (const value_type& val)
+		{
+			if (_start._cur == _start._first)
+				grow_front();
+			iterator tmp(_start);
+			--tmp;
+			_alloc.construct(tmp._cur, val);
+			_start = tmp;
+		}
+
+#ifdef FT_CXX11
+		void push_back (value_type&& val)
+		{
+			emplace_back(std::move(val));
+		}
+
+		void push_front (value_type&& val)
+		{
+			emplace_front(std::move(val));
+		}
+
+		template <class... Args>
+		void emplace_back (Args&&... args)
+		{
+			if (_finish._last - _finish._cur <= 1)
+				grow_back();
+			_alloc.construct(_finish._cur, std::forward<Args>(args)...);
+			++_finish;
+		}
+
+		template <class... Args>
+		void emplace_front (Args&&... args)
+		{
+			if (_start._cur == _start._first)
+				grow_front();
+			iterator tmp(_start);
+			--tmp;
+			_alloc.construct(tmp._cur, std::forward<Args>(args)...);
+			_start = tmp;
+		}
+#endif
+
+		void pop_back()
+		{
+			if (_finish._cur == _finish._first)
+				release_block(_finish._node + 1);
+			--_finish;
+			_alloc.destroy(_finish._cur);
+		}
+
+		void pop_front()
+		{
+			_alloc.destroy(_start._cur);
+			if (_start._cur + 1 == _start._last)
+				release_block(_start._node - 1);
+			++_start;
+		}
+
+		/*
+		** Inserts go in at the closer end and are rotated into place, so at
+		** most half of the elements move.
+		*/
+		iterator insert (iterator position, const value_type& val)
+		{
+			difference_type offset = position - _start;
+			insert(position, 1, val);
+			return (begin() + offset);
+		}
+
+		void insert (iterator position, size_type n, const value_type& val)
+		{
+			size_type	offset = position - _start;
+
+			if (offset < size() / 2)
+			{
+				for (size_type i = 0; i != n; i++)
+					push_front(val);
+				std::rotate(begin(), begin() + n, begin() + n + offset);
+			}
+			else
+			{
+				size_type old_size = size();
+				fill_back(n, val);
+				std::rotate(begin() + offset, begin() + old_size, end());
+			}
+		}
+
+		template <class InputIterator>
+		void insert (iterator position, InputIterator first, InputIterator last,
+					 typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL)
+		{
+			size_type	offset = position - _start;
+			size_type	old_size = size();
+
+			append(first, last);
+			std::rotate(begin() + offset, begin() + old_size, end());
+		}
+
+		iterator erase (iterator position)
+		{
+			return (erase(position, position + 1));
+		}
+
+		iterator erase (iterator first, iterator last)
+		{
+			size_type	n = last - first;
+			size_type	offset = first - _start;
+
+			if (offset < (size() - n) / 2)
+			{
+				std::copy_backward(begin(), first, last);
+				for (size_type i = 0; i != n; i++)
+					pop_front();
+			}
+			else
+			{
+				std::copy(last, end(), first);
+				for (size_type i = 0; i != n; i++)
+					pop_back();
+			}
+			return (begin() + offset);
+		}
+
+		void swap (deque& x)
+		{
+			std::swap(_alloc, x._alloc);
+			std::swap(_map_alloc, x._map_alloc);
+			std::swap(_map, x._map);
+			std::swap(_map_size, x._map_size);
+			std::swap(_start, x._start);
+			std::swap(_finish, x._finish);
+		}
+
+		/* Destroys the elements and keeps a single block. */
+		void clear()
+		{
+			if (_map == NULL)
+				return ;
+			destroy_range(_start, _finish);
+			release_blocks_outside(_start._node, _start._node);
+			_finish = _start;
+		}
+
+		allocator_type get_allocator() const
+		{
+			return (_alloc);
+		}
+	};
+
+	template <class T, class Alloc>
+	bool operator== (const deque<T,Alloc>& lhs, const deque<T,Alloc>& rhs)
+	{
+		if (lhs.size() != rhs.size())
+			return (false);
+		return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <class T, class Alloc>
+	bool operator!= (const deque<T,Alloc>& lhs, const deque<T,Alloc>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template <class T, class Alloc>
+	bool operator< (const deque<T,Alloc>& lhs, const deque<T,Alloc>& rhs)
+	{
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template <class T, class Alloc>
+	bool operator<= (const deque<T,Alloc>& lhs, const deque<T,Alloc>& rhs)
+	{
+		return (!(rhs < lhs));
+	}
+
+	template <class T, class Alloc>
+	bool operator> (const deque<T,Alloc>& lhs, const deque<T,Alloc>& rhs)
+	{
+		return (rhs < lhs);
+	}
+
+	template <class T, class Alloc>
+	bool operator>= (const deque<T,Alloc>& lhs, const deque<T,Alloc>& rhs)
+	{
+		return (!(lhs < rhs));
+	}
+
+	template <class T, class Alloc>
+	void swap (deque<T,Alloc>& x, deque<T,Alloc>& y)
+	{
+		x.swap(y);
+	}
+}
+
+#endif
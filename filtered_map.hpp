@@ -0,0 +1,342 @@
+#pragma once
+#ifndef FILTERED_MAP_HPP
+#define FILTERED_MAP_HPP
+
+#include <cmath>
+#include <memory>
+#include "utils.hpp"
+#include "vector.hpp"
+
+namespace ft
+{
+	/*
+	** Blocked Bloom filter in front of an ordered map (ft::map, ft::split_map).
+	** Every key owns one 64-byte block, so a miss costs one cache line probe
+	** instead of a full tree descent. Inserts keep the filter in sync; erases
+	** leave stale bits behind, which only cost false positives, and the erase
+	** that makes a quarter of the keys stale rebuilds the filter. Keeping every
+	** probe in one block makes the real false positive rate land a little
+	** above the configured one; stats() reports what actually happens.
+	** Lookups through a const filtered_map write nothing, so any number of
+	** threads may run them at once; lookups through a non-const one also
+	** count themselves in stats().
+	*/
+	template <class Map, class Hash = ft::hash<typename Map::key_type> >
+	class filtered_map
+	{
+	public:
+		typedef Map										map_type;
+		typedef Hash									hasher;
+		typedef typename map_type::key_type				key_type;
+		typedef typename map_type::mapped_type			mapped_type;
+		typedef typename map_type::value_type			value_type;
+		typedef typename map_type::iterator				iterator;
+		typedef typename map_type::const_iterator		const_iterator;
+		typedef typename map_type::size_type			size_type;
+
+		struct filter_stats
+		{
+			size_type	lookups;
+			size_type	filtered;
+			size_type	false_positives;
+			size_type	rebuilds;
+
+			filter_stats() : lookups(0), filtered(0), false_positives(0), rebuilds(0) {}
+		};
+	private:
+		typedef unsigned long							word_type;
+
+		static const size_t	_block_bits = 512;
+		static const size_t	_word_bits = sizeof(word_type) * 8;
+		static const size_t	_block_words = _block_bits / _word_bits;
+
+		map_type						_map;
+		hasher							_hash;
+		double							_fp_rate;
+		ft::vector<word_type>			_bits;
+		size_type						_nblocks;
+		size_type						_probes;
+		size_type						_planned;
+		size_type						_stale;
+		filter_stats					_stats;
+
+		/*
+		** The high half of the hash picks the block and the low half the bits
+		** inside it, so keys that share a block do not share their probes too.
+		*/
+		size_t hash_key (const key_type& k, size_t& h1, size_t& h2) const
+		{
+			static const size_t	half = sizeof(size_t) * 4;
+			size_t				h = _hash(k);
+			size_t				low = h & (((size_t)1 << half) - 1);
+
+			h1 = low;
+			h2 = (low >> (half / 2)) | 1;
+			return (((h >> half) % _nblocks) * _block_words);
+		}
+
+		void add_key (const key_type& k)
+		{
+			size_t		h1;
+			size_t		h2;
+			word_type	*block = &_bits[hash_key(k, h1, h2)];
+
+			for (size_type i = 0; i != _probes; i++)
+			{
+				size_t bit = (h1 + i * h2) % _block_bits;
+				block[bit / _word_bits] |= (word_type)1 << (bit % _word_bits);
+			}
+		}
+
+		bool may_contain (const key_type& k) const
+		{
+			size_t			h1;
+			size_t			h2;
+			const word_type	*block = &_bits[hash_key(k, h1, h2)];
+
+			for (size_type i = 0; i != _probes; i++)
+			{
+				size_t bit = (h1 + i * h2) % _block_bits;
+				if (!(block[bit / _word_bits] & ((word_type)1 << (bit % _word_bits))))
+					return (false);
+			}
+			return (true);
+		}
+
+		/* Sizes the filter for `expected` keys at _fp_rate and refills it. */
+		void rebuild (size_type expected)
+		{
+			if (expected == 0)
+				expected = 1;
+			double ln2 = std::log(2.0);
+			double bits = -(double)expected * std::log(_fp_rate) / (ln2 * ln2);
+
+			_planned = expected;
+			_nblocks = (size_type)(bits / _block_bits) + 1;
+			_probes = (size_type)(bits / expected * ln2 + 0.5);
+			if (_probes < 1)
+				_probes = 1;
+			if (_probes > 16)
+				_probes = 16;
+			_bits.assign(_nblocks * _block_words, 0);
+			for (const_iterator it = _map.begin(); it != _map.end(); it++)
+				add_key(it->first);
+			_stale = 0;
+			_stats.rebuilds++;
+		}
+
+		/* Erased keys keep their bits; rebuild once they are a quarter of the filter. */
+		void erased (size_type n)
+		{
+			_stale += n;
+			if (_stale * 4 > _map.size() + 4)
+				rebuild(_planned);
+		}
+	public:
+		explicit filtered_map (double fp_rate = 0.01, size_type expected = 1024) :
+			_map(), _hash(), _fp_rate(fp_rate), _bits(), _nblocks(0), _probes(0), _planned(0), _stale(0), _stats()
+		{
+			rebuild(expected);
+		}
+
+		filtered_map (const filtered_map& x) :
+			_map(x._map), _hash(x._hash), _fp_rate(x._fp_rate), _bits(x._bits), _nblocks(x._nblocks),
+			_probes(x._probes), _planned(x._planned), _stale(x._stale), _stats() {}
+
+		filtered_map& operator=(const filtered_map& x)
+		{
+			if (this == &x)
+				return (*this);
+			_map = x._map;
+			_hash = x._hash;
+			_fp_rate = x._fp_rate;
+			_bits = x._bits;
+			_nblocks = x._nblocks;
+			_probes = x._probes;
+			_planned = x._planned;
+			_stale = x._stale;
+			return (*this);
+		}
+
+#ifdef FT_CXX11
+		filtered_map (filtered_map&& x) :
+			_map(std::move(x._map)), _hash(x._hash), _fp_rate(x._fp_rate), _bits(std::move(x._bits)), _nblocks(x._nblocks),
+			_probes(x._probes), _planned(x._planned), _stale(x._stale), _stats()
+		{
+			x.rebuild(x._planned);
+		}
+
+		filtered_map& operator=(filtered_map&& x)
+		{
+			if (this == &x)
+				return (*this);
+			_map = std::move(x._map);
+			_hash = x._hash;
+			_fp_rate = x._fp_rate;
+			_bits = std::move(x._bits);
+			_nblocks = x._nblocks;
+			_probes = x._probes;
+			_planned = x._planned;
+			_stale = x._stale;
+			x.rebuild(x._planned);
+			return (*this);
+		}
+#endif
+
+		iterator						begin()
+		{
+			return (_map.begin());
+		}
+
+		const_iterator					begin() const
+		{
+			return (_map.begin());
+		}
+
+		iterator						end()
+		{
+			return (_map.end());
+		}
+
+		const_iterator					end() const
+		{
+			return (_map.end());
+		}
+
+		bool							empty() const
+		{
+			return (_map.empty());
+		}
+
+		size_type						size() const
+		{
+			return (_map.size());
+		}
+
+		const map_type&					base() const
+		{
+			return (_map);
+		}
+
+		iterator						find(const key_type& k)
+		{
+			_stats.lookups++;
+			if (!may_contain(k))
+			{
+				_stats.filtered++;
+				return (_map.end());
+			}
+			iterator it = _map.find(k);
+			if (it == _map.end())
+				_stats.false_positives++;
+			return (it);
+		}
+
+		const_iterator					find(const key_type& k) const
+		{
+			if (!may_contain(k))
+				return (_map.end());
+			return (_map.find(k));
+		}
+
+		size_type						count(const key_type& k)
+		{
+			_stats.lookups++;
+			if (!may_contain(k))
+			{
+				_stats.filtered++;
+				return (0);
+			}
+			size_type n = _map.count(k);
+			if (n == 0)
+				_stats.false_positives++;
+			return (n);
+		}
+
+		size_type						count(const key_type& k) const
+		{
+			if (!may_contain(k))
+				return (0);
+			return (_map.count(k));
+		}
+
+		ft::pair<iterator,bool>			insert(const value_type& val)
+		{
+			ft::pair<iterator,bool> ret = _map.insert(val);
+			if (ret.second)
+			{
+				if (_map.size() > _planned)
+					rebuild(_planned * 2);
+				else
+					add_key(val.first);
+			}
+			return (ret);
+		}
+
+		template <class InputIterator>
+		void							insert(InputIterator first, InputIterator last)
+		{
+			while (first != last)
+			{
+				insert(*first);
+				first++;
+			}
+		}
+
+		void							erase(iterator position)
+		{
+			_map.erase(position);
+			erased(1);
+		}
+
+		void							erase(iterator first, iterator last)
+		{
+			size_type before = _map.size();
+			_map.erase(first, last);
+			erased(before - _map.size());
+		}
+
+		size_type						erase(const key_type& k)
+		{
+			size_type n = _map.erase(k);
+			erased(n);
+			return (n);
+		}
+
+		void							clear()
+		{
+			_map.clear();
+			_bits.assign(_bits.size(), 0);
+			_stale = 0;
+		}
+
+		mapped_type& operator[] (const key_type& k)
+		{
+			return ((*((this->insert(ft::make_pair(k,mapped_type()))).first)).second);
+		}
+
+		/* Changes the target false positive rate; takes effect immediately. */
+		void							false_positive_rate(double fp_rate)
+		{
+			_fp_rate = fp_rate;
+			rebuild(_planned);
+		}
+
+		double							false_positive_rate() const
+		{
+			return (_fp_rate);
+		}
+
+		const filter_stats&				stats() const
+		{
+			return (_stats);
+		}
+
+		void							reset_stats()
+		{
+			_stats = filter_stats();
+		}
+	};
+}
+
+#endif
@@ -3,6 +3,7 @@
 #define ITERATOR_HPP
 
 #include <cstddef>
+#include <iterator>
 #include "utils.hpp"
 
 namespace ft
@@ -48,6 +49,11 @@ namespace ft
 		typedef Category 	iterator_category;
 	};
 
+	/*
+	** The iterators below hold nothing but pointers and leave copy, assignment
+	** and destruction to the compiler: no vtable, trivially copyable, passed
+	** in registers, so a loop over them compiles to the raw pointer loop.
+	*/
     template <class T>
 	class random_access_iterator : public iterator<std::random_access_iterator_tag, T>
 	{
@@ -63,14 +69,6 @@ namespace ft
 
         random_access_iterator(void) : _i(0){}
 		random_access_iterator(pointer elem) : _i(elem){}
-		random_access_iterator(const random_access_iterator& src) : _i(src._i){}
-		virtual ~random_access_iterator() {}
-
-		random_access_iterator& operator=(const random_access_iterator& src)
-		{
-			this->_i = src._i;
-			return (*this);
-		}
 
 		random_access_iterator &operator++(void)
 		{
@@ -225,7 +223,6 @@ namespace ft
 		explicit reverse_iterator(iterator_type it) : rev_i(it){}
 		template <class Iterator>
 			reverse_iterator (const reverse_iterator<Iterator>& it) : rev_i(it.base()){}
-		virtual ~reverse_iterator() {}
 
 		iterator_type base() const
 		{
@@ -375,8 +372,13 @@ namespace ft
 	{
 		return (lco.base() <= rco.base());
 	}
+	/*
+	** distance and advance pick their implementation from iterator_category:
+	** constant time for random access iterators, a walk for the rest.
+	*/
 	template <class Iterator>
-	typename iterator_traits<Iterator>::difference_type distance (Iterator first, Iterator last)
+	typename iterator_traits<Iterator>::difference_type distance_impl (Iterator first, Iterator last,
+																	   std::input_iterator_tag)
 	{
 		typename iterator_traits<Iterator>::difference_type n = 0;
 		while (first != last)
@@ -386,6 +388,61 @@ namespace ft
 		}
 		return (n);
 	}
+
+	template <class Iterator>
+	typename iterator_traits<Iterator>::difference_type distance_impl (Iterator first, Iterator last,
+																	   std::random_access_iterator_tag)
+	{
+		return (last - first);
+	}
+
+	template <class Iterator>
+	typename iterator_traits<Iterator>::difference_type distance (Iterator first, Iterator last)
+	{
+		return (distance_impl(first, last, typename iterator_traits<Iterator>::iterator_category()));
+	}
+
+	template <class Iterator, class Distance>
+	void advance_impl (Iterator& it, Distance n, std::input_iterator_tag)
+	{
+		for (; n > 0; n--)
+			it++;
+	}
+
+	template <class Iterator, class Distance>
+	void advance_impl (Iterator& it, Distance n, std::bidirectional_iterator_tag)
+	{
+		for (; n > 0; n--)
+			it++;
+		for (; n < 0; n++)
+			it--;
+	}
+
+	template <class Iterator, class Distance>
+	void advance_impl (Iterator& it, Distance n, std::random_access_iterator_tag)
+	{
+		it += n;
+	}
+
+	template <class Iterator, class Distance>
+	void advance (Iterator& it, Distance n)
+	{
+		advance_impl(it, n, typename iterator_traits<Iterator>::iterator_category());
+	}
+
+	template <class Iterator>
+	Iterator next (Iterator it, typename iterator_traits<Iterator>::difference_type n = 1)
+	{
+		ft::advance(it, n);
+		return (it);
+	}
+
+	template <class Iterator>
+	Iterator prev (Iterator it, typename iterator_traits<Iterator>::difference_type n = 1)
+	{
+		ft::advance(it, -n);
+		return (it);
+	}
 	
 	template <class value_type>
 	struct binary_tree
@@ -395,13 +452,19 @@ namespace ft
 		binary_tree *_left_node;
 		binary_tree *_right_node;
 		binary_tree *_parent_node;
+		size_t _count;
 		bool red;
 
-		binary_tree() : _value(value_type()), _left_node(NULL), _right_node(NULL), _parent_node(NULL), red(true) {}
+		binary_tree() : _value(value_type()), _left_node(NULL), _right_node(NULL), _parent_node(NULL), _count(1), red(true) {}
 		explicit binary_tree(const value_type &value, binary_tree *parent = NULL, binary_tree *left = NULL, binary_tree *right = NULL) :
-				_value(value), _left_node(left), _right_node(right), _parent_node(parent), red(true) {}
+				_value(value), _left_node(left), _right_node(right), _parent_node(parent), _count(1), red(true) {}
+#ifdef FT_CXX11
+		explicit binary_tree(value_type&& value) :
+				_value(std::move(value)), _left_node(NULL), _right_node(NULL), _parent_node(NULL), _count(1), red(true) {}
+#endif
 		binary_tree(const binary_tree &src) :
-				_value(src._value), _left_node(src._left_node), _right_node(src._right_node), _parent_node(src._parent_node), red(src.red) {};
+				_value(src._value), _left_node(src._left_node), _right_node(src._right_node), _parent_node(src._parent_node),
+				_count(src._count), red(src.red) {};
 
 		binary_tree &operator=(const binary_tree &src)
 		{
@@ -411,6 +474,7 @@ namespace ft
 			_left_node = src._left_node;
 			_right_node = src._right_node;
 			_parent_node = src._parent_node;
+			_count = src._count;
 			//this->red = src.red;
 			return (*this);
 		}
@@ -446,16 +510,6 @@ namespace ft
 		map_iterator(void) : node(NULL), last(NULL), null_node(NULL){}
 		map_iterator(T2 *elem) : node(elem), last(elem), null_node(NULL){}
 		map_iterator(T2 *_node, T2 *_last) : node(_node), last(_last), null_node(NULL){}
-		map_iterator(const map_iterator& it) : node(it.node), last(it.last), null_node(it.null_node){}
-		virtual ~map_iterator() {}
-
-		map_iterator& operator=(const map_iterator& it)
-		{
-			this->node = it.node;
-			this->last = it.last;
-			this->null_node = it.null_node;
-			return (*this);
-		}
 
 		map_iterator &operator++(void)
 		{
@@ -5,8 +5,10 @@
 #include <iostream>
 #include <memory>
 #include <stdexcept>
+#include <pthread.h>
 #include "iterator.hpp"
 #include "utils.hpp"
+#include "vector.hpp"
 
 namespace ft
 {
@@ -18,7 +20,7 @@ namespace ft
 		typedef T										mapped_type;
 		typedef ft::pair<const key_type, mapped_type>	value_type;
 		typedef Compare									key_compare;
-		class value_compare : public std::binary_function<value_type, value_type, bool>
+		class value_compare
 		{
 			friend class map;
 
@@ -50,13 +52,21 @@ namespace ft
 		typedef typename ft::iterator_traits<iterator>::difference_type					difference_type;
 		typedef typename allocator_type::size_type                                      size_type;
     private:
-		typedef binary_tree<value_type>				b_tree;
+		typedef binary_tree<value_type>										b_tree;
+		typedef typename allocator_type::template rebind<b_tree>::other	tree_allocator_type;
 		allocator_type                          	_alloc;
 		value_compare                                _comp;
 		size_type									_size;
-		std::allocator<b_tree> 						_alloc_tree;
+		tree_allocator_type							_alloc_tree;
 		b_tree										*_root;
 		b_tree										*_null_node;
+		mutable b_tree								*_last_hit;
+		bool										_lookup_cache;
+
+		bool key_less (const key_type& a, const key_type& b) const
+		{
+			return (_comp.comp(a, b));
+		}
 
 		b_tree *findnode (const key_type& k, b_tree *start) const
 		{
@@ -89,6 +99,282 @@ namespace ft
 			return _null_node;
 		}
 
+		/*
+		** Finger search: climb from `finger` until the subtree we stand in
+		** brackets k, then descend with findnode. Cost grows with the distance
+		** between k and the finger instead of the depth of the whole tree.
+		*/
+		b_tree *fingernode (const key_type& k, b_tree *finger) const
+		{
+			b_tree	*tmp;
+			bool	right;
+
+			tmp = finger;
+			if (tmp == _null_node)
+				return (findnode(k, _root));
+			if (tmp->_value.first == k)
+				return (tmp);
+			right = key_less(tmp->_value.first, k);
+			while (tmp->_parent_node != _null_node)
+			{
+				b_tree *parent = tmp->_parent_node;
+				if (right && parent->_left_node == tmp && key_less(k, parent->_value.first))
+					break;
+				if (!right && parent->_right_node == tmp && key_less(parent->_value.first, k))
+					break;
+				tmp = parent;
+			}
+			return (findnode(k, tmp));
+		}
+
+		size_t node_count (const b_tree *node) const
+		{
+			if (node == _null_node)
+				return (0);
+			return (node->_count);
+		}
+
+		void count_path (b_tree *node, long diff)
+		{
+			for (; node != _null_node; node = node->_parent_node)
+				node->_count += diff;
+		}
+
+		/*
+		** Cuts the subtree at `node` along the search path of k: keys below k
+		** end up in `lo`, the others in `hi`. Only the path is relinked. The
+		** descent is a loop that keeps the open link at the bottom of each
+		** side, so a degenerate tree does not cost one stack frame per level.
+		*/
+		void split_tree (b_tree *node, const key_type& k, b_tree *&lo, b_tree *&hi)
+		{
+			b_tree	**lo_link = &lo;
+			b_tree	**hi_link = &hi;
+			b_tree	*lo_tail = _null_node;
+			b_tree	*hi_tail = _null_node;
+
+			while (node != _null_node)
+			{
+				if (key_less(node->_value.first, k))
+				{
+					*lo_link = node;
+					node->_parent_node = lo_tail;
+					lo_tail = node;
+					lo_link = &node->_right_node;
+					node = node->_right_node;
+				}
+				else
+				{
+					*hi_link = node;
+					node->_parent_node = hi_tail;
+					hi_tail = node;
+					hi_link = &node->_left_node;
+					node = node->_left_node;
+				}
+			}
+			*lo_link = _null_node;
+			*hi_link = _null_node;
+			for (; lo_tail != _null_node; lo_tail = lo_tail->_parent_node)
+				lo_tail->_count = 1 + node_count(lo_tail->_left_node) + node_count(lo_tail->_right_node);
+			for (; hi_tail != _null_node; hi_tail = hi_tail->_parent_node)
+				hi_tail->_count = 1 + node_count(hi_tail->_left_node) + node_count(hi_tail->_right_node);
+		}
+
+		struct key_of
+		{
+			const key_type& operator() (const value_type& v) const { return (v.first); }
+		};
+
+		struct mapped_of
+		{
+			const mapped_type& operator() (const value_type& v) const { return (v.second); }
+		};
+
+		const b_tree *leftmost (const b_tree *node) const
+		{
+			while (node->_left_node != _null_node)
+				node = node->_left_node;
+			return (node);
+		}
+
+		/* In-order successor of node, or `stop` once the walk climbs out of stop's subtree. */
+		const b_tree *next_node (const b_tree *node, const b_tree *stop) const
+		{
+			if (node->_right_node != _null_node)
+				return (leftmost(node->_right_node));
+			const b_tree *child;
+			do
+			{
+				child = node;
+				node = node->_parent_node;
+			} while (node != stop && node->_right_node == child);
+			return (node);
+		}
+
+		/*
+		** Writes the subtree at `node` in key order to dst[0 .. node_count(node)).
+		** The pending ancestors live on an explicit stack that starts on the
+		** call frame and moves to the heap for a long left spine, so the depth
+		** of an unbalanced tree costs memory instead of call frames.
+		*/
+		template <class Out, class Get>
+		void export_subtree (const b_tree *node, Out *dst) const
+		{
+			Get							get;
+			const b_tree				*local[128];
+			const b_tree				**pending = local;
+			size_t						top = 0;
+			size_t						cap = 128;
+			ft::vector<const b_tree *>	spill;
+
+			while (true)
+			{
+				for (; node != _null_node; node = node->_left_node)
+				{
+					if (top == cap)
+					{
+						ft::vector<const b_tree *> bigger(pending, pending + top);
+						bigger.resize(cap * 2);
+						spill.swap(bigger);
+						pending = &spill[0];
+						cap *= 2;
+					}
+					pending[top++] = node;
+				}
+				if (top == 0)
+					return ;
+				node = pending[--top];
+				*dst++ = get(node->_value);
+				node = node->_right_node;
+			}
+		}
+
+		template <class Out, class Get>
+		struct export_task
+		{
+			const map		*tree;
+			const b_tree	*node;
+			Out				*dst;
+		};
+
+		template <class Out, class Get>
+		struct export_worker
+		{
+			const export_task<Out, Get>	*tasks;
+			size_t						first;
+			size_t						count;
+			size_t						step;
+
+			static void *run(void *arg)
+			{
+				export_worker *self = static_cast<export_worker *>(arg);
+				for (size_t i = self->first; i < self->count; i += self->step)
+				{
+					const export_task<Out, Get> &task = self->tasks[i];
+					task.tree->template export_subtree<Out, Get>(task.node, task.dst);
+				}
+				return (NULL);
+			}
+		};
+
+		/*
+		** Cuts the top `depth` levels of the tree into independent subtrees;
+		** the nodes above the cut are written on the spot, since their output
+		** slot is known from the subtree counts.
+		*/
+		template <class Out, class Get>
+		void plan_export (const b_tree *node, Out *dst, size_t depth, ft::vector<export_task<Out, Get> >& tasks) const
+		{
+			if (node == _null_node)
+				return ;
+			if (depth == 0 || node->_count < 4096)
+			{
+				export_task<Out, Get> task;
+				task.tree = this;
+				task.node = node;
+				task.dst = dst;
+				tasks.push_back(task);
+				return ;
+			}
+			size_t left = node_count(node->_left_node);
+			dst[left] = Get()(node->_value);
+			plan_export<Out, Get>(node->_left_node, dst, depth - 1, tasks);
+			plan_export<Out, Get>(node->_right_node, dst + left + 1, depth - 1, tasks);
+		}
+
+		template <class Out, class Get>
+		void export_all (ft::vector<Out>& out, size_type threads) const
+		{
+			size_type	old_size = out.size();
+
+			if (_size == 0)
+				return ;
+			out.resize(old_size + _size);
+			Out *dst = &out[old_size];
+			if (threads <= 1)
+			{
+				export_subtree<Out, Get>(_root, dst);
+				return ;
+			}
+			size_t depth = 1;
+			while (((size_t)1 << depth) < threads * 4)
+				depth++;
+			ft::vector<export_task<Out, Get> >	tasks;
+			ft::vector<export_worker<Out, Get> >	workers(threads);
+			ft::vector<pthread_t>				ids(threads);
+			ft::vector<bool>					started(threads, false);
+			plan_export<Out, Get>(_root, dst, depth, tasks);
+			for (size_type i = 0; i != threads; i++)
+			{
+				workers[i].tasks = &tasks[0];
+				workers[i].first = i;
+				workers[i].count = tasks.size();
+				workers[i].step = threads;
+				if (i != 0)
+					started[i] = (pthread_create(&ids[i], NULL, &export_worker<Out, Get>::run, &workers[i]) == 0);
+			}
+			export_worker<Out, Get>::run(&workers[0]);
+			for (size_type i = 1; i != threads; i++)
+			{
+				if (started[i])
+					pthread_join(ids[i], NULL);
+				else
+					export_worker<Out, Get>::run(&workers[i]);
+			}
+		}
+
+		template <class V>
+		void export_range (const b_tree *node, const key_type& lo, const key_type& hi, ft::vector<V>& out) const
+		{
+			const b_tree *first = _null_node;
+
+			while (node != _null_node)
+			{
+				if (key_less(node->_value.first, lo))
+					node = node->_right_node;
+				else
+				{
+					first = node;
+					node = node->_left_node;
+				}
+			}
+			for (node = first; node != _null_node && key_less(node->_value.first, hi); node = next_node(node, _null_node))
+				out.push_back(node->_value);
+		}
+
+		b_tree	*find_min_node() const
+		{
+			b_tree	*tmp;
+
+			tmp = _root;
+			if (tmp != _null_node)
+			{
+				while (tmp->_left_node != _null_node)
+					tmp = tmp->_left_node;
+			}
+			return (tmp);
+		}
+
 		b_tree	*find_max_node() const
 		{
 			b_tree	*tmp;
@@ -102,18 +388,52 @@ namespace ft
 			return (tmp);
 		}
     public:
+		/*
+		** Remembers a position in the tree so that the next seek() starts
+		** from there instead of from _root. Invalidated like an iterator:
+		** erasing the node it stands on leaves it dangling. A default
+		** constructed cursor belongs to no map and seeks to iterator().
+		*/
+		class cursor
+		{
+			friend class map;
+		private:
+			map		*_map;
+			b_tree	*_node;
+		public:
+			cursor() : _map(NULL), _node(NULL) {}
+			explicit cursor(map& m) : _map(&m), _node(m._root) {}
+
+			iterator seek(const key_type& k)
+			{
+				if (_map == NULL)
+					return (iterator());
+				_node = _map->fingernode(k, _node);
+				if (_node != _map->_null_node && _node->_value.first == k)
+					return (iterator(_node));
+				return (_map->end());
+			}
+
+			iterator get() const
+			{
+				return (iterator(_node));
+			}
+		};
+		friend class cursor;
+
 		explicit map (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) :
-            _alloc(alloc), _comp(comp), _size(0), _root(), _null_node() {}
+            _alloc(alloc), _comp(comp), _size(0), _alloc_tree(alloc), _root(), _null_node(), _last_hit(), _lookup_cache(false) {}
 
 		template <class InputIterator>
 		map (InputIterator first, InputIterator last,
 			 const key_compare& comp = key_compare(),
-			 const allocator_type& alloc = allocator_type()) : _alloc(alloc), _comp(comp), _size(0), _root(), _null_node()
+			 const allocator_type& alloc = allocator_type()) : _alloc(alloc), _comp(comp), _size(0), _alloc_tree(alloc), _root(), _null_node(),
+			 _last_hit(), _lookup_cache(false)
 		{
 			insert(first, last);
 		}
 
-        map (const map& x) : _comp(x.key_comp()), _size(0), _root(), _null_node()
+        map (const map& x) : _comp(x.key_comp()), _size(0), _root(), _null_node(), _last_hit(), _lookup_cache(false)
 		{
 			_alloc = x._alloc;
 			_alloc_tree = x._alloc_tree;
@@ -132,6 +452,22 @@ namespace ft
 			return (*this);
 		}
 
+#ifdef FT_CXX11
+		map (map&& x) noexcept : _comp(x.key_comp()), _size(0), _root(), _null_node(), _last_hit(), _lookup_cache(false)
+		{
+			swap(x);
+		}
+
+		map& operator=(map&& x) noexcept
+		{
+			if (this == &x)
+				return (*this);
+			clear();
+			swap(x);
+			return (*this);
+		}
+#endif
+
         ~map()
 		{
 			for (iterator it = begin(); it != end(); it++)
@@ -206,20 +542,44 @@ namespace ft
 
         iterator							find(const key_type& k)
 		{
+			if (_lookup_cache && _last_hit != _null_node && _last_hit->_value.first == k)
+				return (iterator(_last_hit));
 			b_tree *res = findnode(k, _root);
-			if (res->_value.first == k)
+			if (res != _null_node && res->_value.first == k)
+			{
+				if (_lookup_cache)
+					_last_hit = res;
 				return (iterator(res));
+			}
 			return (end());
 		}
 
         const_iterator						find(const key_type& k) const
 		{
+			if (_lookup_cache && _last_hit != _null_node && _last_hit->_value.first == k)
+				return (const_iterator(_last_hit));
 			b_tree *res = findnode(k, _root);
-			if (res->_value.first == k)
+			if (res != _null_node && res->_value.first == k)
+			{
+				if (_lookup_cache)
+					_last_hit = res;
 				return (const_iterator(res));
+			}
 			return (end());
 		}
 
+		/*
+		** Opt-in cache of the last node returned by find(), so that repeated
+		** lookups of the same key skip the descent from _root. While it is on,
+		** const lookups (find, count) write the cache, so they are no longer
+		** safe to run from several threads on the same map.
+		*/
+		void								lookup_cache(bool enable)
+		{
+			_lookup_cache = enable;
+			_last_hit = _null_node;
+		}
+
         size_type							count(const key_type& k) const
 		{
 			if (find(k) != end())
@@ -360,6 +720,7 @@ namespace ft
 					_alloc_tree.construct(input_node->_left_node, tmp);
 					input_node->_left_node->_parent_node = input_node;
 					ret = input_node->_left_node;
+					count_path(input_node, 1);
 					_size++;
 				}
 				else
@@ -368,6 +729,7 @@ namespace ft
 					_alloc_tree.construct(input_node->_right_node, tmp);
 					input_node->_right_node->_parent_node = input_node;
 					ret = input_node->_right_node;
+					count_path(input_node, 1);
 					_size++;
 				}
 			}
@@ -398,6 +760,7 @@ namespace ft
 				input_node->_left_node = _alloc_tree.allocate(1);
 				_alloc_tree.construct(input_node->_left_node, tmp);
 				input_node->_left_node->_parent_node = input_node;
+				count_path(input_node, 1);
 				_size++;
 				return (input_node->_left_node);
 			}
@@ -406,11 +769,58 @@ namespace ft
 				input_node->_right_node = _alloc_tree.allocate(1);
 				_alloc_tree.construct(input_node->_right_node, tmp);
 				input_node->_right_node->_parent_node = input_node;
+				count_path(input_node, 1);
 				_size++;
 				return (input_node->_right_node);
 			}
 		}
 
+#ifdef FT_CXX11
+		ft::pair<iterator,bool>				insert(value_type&& val)
+		{
+			return (emplace(std::move(val)));
+		}
+
+		/*
+		** Builds the entry from args once and moves it into the new node; the
+		** mapped value is never copied. Like std::map, a duplicate key still
+		** costs the construction of the entry.
+		*/
+		template <class... Args>
+		ft::pair<iterator,bool>				emplace(Args&&... args)
+		{
+			value_type	val(std::forward<Args>(args)...);
+			b_tree		*parent = _null_node;
+
+			if (_root != _null_node)
+			{
+				parent = findnode(val.first, _root);
+				if (val.first == parent->_value.first)
+					return (ft::make_pair(iterator(parent), false));
+			}
+			b_tree *node = _alloc_tree.allocate(1);
+			try
+			{
+				_alloc_tree.construct(node, std::move(val));
+			}
+			catch (...)
+			{
+				_alloc_tree.deallocate(node, 1);
+				throw ;
+			}
+			node->_parent_node = parent;
+			if (parent == _null_node)
+				_root = node;
+			else if (!_comp(parent->_value, node->_value))
+				parent->_left_node = node;
+			else
+				parent->_right_node = node;
+			count_path(parent, 1);
+			_size++;
+			return (ft::make_pair(iterator(node), true));
+		}
+#endif
+
         template <class InputIterator>
 		void								insert(InputIterator first, InputIterator last)
 		{
@@ -425,19 +835,19 @@ namespace ft
 		{
             if (++position == end())
             {
-                ft::map<key_type, mapped_type>   src(begin(), --position);
+                map   src(begin(), --position, _comp.comp, _alloc);
                 this->swap(src);
                 //src.clear();
             }
             else if (--position == begin())
             {
-                ft::map<key_type, mapped_type>   src(++position , end());
+                map   src(++position , end(), _comp.comp, _alloc);
                 this->swap(src);
                 //src.clear();
             }
             else
             {
-                ft::map<key_type, mapped_type>   src(begin(), position);
+                map   src(begin(), position, _comp.comp, _alloc);
 				++position;
                 src.insert(position , this->end());
                 this->swap(src);
@@ -459,19 +869,19 @@ namespace ft
 		{
 			if (last == end())
             {
-                ft::map<key_type, mapped_type>   src(begin(), first);
+                map   src(begin(), first, _comp.comp, _alloc);
                 this->swap(src);
                 //src.clear();
             }
             else if (first == begin())
             {
-                ft::map<key_type, mapped_type>   src(last , end());
+                map   src(last , end(), _comp.comp, _alloc);
                 this->swap(src);
                 //src.clear();
             }
             else
             {
-                ft::map<key_type, mapped_type>   src(begin(), first);
+                map   src(begin(), first, _comp.comp, _alloc);
                 src.insert(last , end());
                 this->swap(src);
                 //src.clear();
@@ -484,7 +894,7 @@ namespace ft
 			allocator_type          tmp_alloc;
 			value_compare			tmp_comp(x.key_comp());
 			size_type				tmp_size;
-			std::allocator<b_tree> 	tmp_alloc_tree;
+			tree_allocator_type		tmp_alloc_tree;
 			b_tree					*tmp_root;
 			b_tree					*tmp_null_node;
 
@@ -505,6 +915,125 @@ namespace ft
 			this->_alloc_tree = tmp_alloc_tree;
 			this->_root = tmp_root;
 			this->_null_node = tmp_null_node;
+			x._last_hit = x._null_node;
+			this->_last_hit = this->_null_node;
+		}
+
+		/* Number of keys that sort before k. */
+		size_type							rank(const key_type& k) const
+		{
+			const b_tree	*tmp = _root;
+			size_type		res = 0;
+
+			while (tmp != _null_node)
+			{
+				if (key_less(tmp->_value.first, k))
+				{
+					res += node_count(tmp->_left_node) + 1;
+					tmp = tmp->_right_node;
+				}
+				else
+					tmp = tmp->_left_node;
+			}
+			return (res);
+		}
+
+		/*
+		** Bulk export: append all keys (or mapped values) in key order. The
+		** output grows once to its final size and is filled by a walk over
+		** the nodes; with threads > 1 disjoint subtrees are walked in
+		** parallel, each into its own slice of the output.
+		*/
+		void								keys_to(ft::vector<key_type>& out, size_type threads = 1) const
+		{
+			export_all<key_type, key_of>(out, threads);
+		}
+
+		void								values_to(ft::vector<mapped_type>& out, size_type threads = 1) const
+		{
+			export_all<mapped_type, mapped_of>(out, threads);
+		}
+
+		/* Appends the entries with keys in [lo, hi); returns how many. */
+		template <class V>
+		size_type							copy_range_to(const key_type& lo, const key_type& hi, ft::vector<V>& out) const
+		{
+			if (!key_less(lo, hi))
+				return (0);
+			size_type n = rank(hi) - rank(lo);
+			out.reserve(out.size() + n);
+			export_range(_root, lo, hi, out);
+			return (n);
+		}
+
+		/*
+		** Moves every entry with a key at or above k into right, dropping
+		** what right held. Only the nodes on the search path of k are
+		** relinked. Cursors on either map are invalidated: the node a cursor
+		** stands on may now belong to the other map.
+		*/
+		void								split(const key_type& k, map& right)
+		{
+			b_tree	*lo;
+			b_tree	*hi;
+
+			if (&right == this)
+				throw std::invalid_argument("map::split into itself");
+			right.clear();
+			split_tree(_root, k, lo, hi);
+			if (lo != _null_node)
+				lo->_parent_node = _null_node;
+			if (hi != _null_node)
+				hi->_parent_node = _null_node;
+			_root = lo;
+			_size = node_count(lo);
+			_last_hit = _null_node;
+			right._root = hi;
+			right._size = node_count(hi);
+			right._last_hit = right._null_node;
+		}
+
+		/*
+		** Takes every entry of x, whose keys must all sort after (or all
+		** before) ours. The smallest node of the upper range becomes the new
+		** root, so only two paths are touched.
+		*/
+		void								join(map& x)
+		{
+			if (x._root == x._null_node)
+				return ;
+			if (_root == _null_node)
+			{
+				swap(x);
+				return ;
+			}
+			if (!key_less(find_max_node()->_value.first, x.find_min_node()->_value.first))
+			{
+				if (!key_less(x.find_max_node()->_value.first, find_min_node()->_value.first))
+					throw std::invalid_argument("map::join overlapping key ranges");
+				swap(x);
+			}
+			b_tree *mid = x.find_min_node();
+			x.count_path(mid->_parent_node, -1);
+			if (mid->_parent_node == x._null_node)
+				x._root = mid->_right_node;
+			else
+				mid->_parent_node->_left_node = mid->_right_node;
+			if (mid->_right_node != x._null_node)
+				mid->_right_node->_parent_node = mid->_parent_node;
+			mid->_left_node = _root;
+			mid->_right_node = x._root;
+			mid->_parent_node = _null_node;
+			_root->_parent_node = mid;
+			if (x._root != x._null_node)
+				x._root->_parent_node = mid;
+			mid->_count = 1 + node_count(mid->_left_node) + node_count(mid->_right_node);
+			_root = mid;
+			_size += x._size;
+			_last_hit = _null_node;
+			x._root = x._null_node;
+			x._size = 0;
+			x._last_hit = x._null_node;
 		}
 
         void								clear()
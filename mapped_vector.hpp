@@ -0,0 +1,532 @@
+#pragma once
+#ifndef MAPPED_VECTOR_HPP
+#define MAPPED_VECTOR_HPP
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "iterator.hpp"
+#include "utils.hpp"
+#include "vector.hpp"
+
+namespace ft
+{
+	/* First 64 bytes of a mapped_vector file; the elements follow. */
+	struct mapped_vector_header
+	{
+		char				magic[8];
+		unsigned long long	element_size;
+		unsigned long long	size;
+		char				pad[40];
+	};
+
+	/*
+	** Vector of trivially copyable T that lives in a file. The whole file is
+	** mapped MAP_SHARED, so opening costs one mmap whatever the size and
+	** pages come in as they are touched; the size is kept in the file header,
+	** so whatever was pushed is there on the next open. Growth extends the
+	** file with ftruncate and the mapping with mremap. flush() msyncs the
+	** mapping to disk. Any number of processes can open the same file
+	** read_only next to one writer; a reader sees the elements that fit in
+	** the part of the file it mapped at open time. The size is published
+	** with a release store after the elements are written, so a reader on
+	** another core never sees a size ahead of the data. Readers hold a
+	** shared flock while open, and shrink_to_fit leaves the file alone
+	** unless it can take the lock exclusively, so it never cuts pages out
+	** from under a reader's mapping. The mapping of a read_only instance is
+	** not writable, so its non-const element access throws std::logic_error
+	** like the modifiers do: readers go through a const mapped_vector&.
+	*/
+	template <class T>
+	class mapped_vector
+	{
+		typedef char needs_trivially_copyable[ft::is_trivially_copyable<T>::value ? 1 : -1];
+	public:
+		typedef T												value_type;
+		typedef T&												reference;
+		typedef const T&										const_reference;
+		typedef T*												pointer;
+		typedef const T*										const_pointer;
+		typedef ft::random_access_iterator<value_type>			iterator;
+		typedef ft::random_access_iterator<const value_type>	const_iterator;
+		typedef ft::reverse_iterator<iterator>					reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>			const_reverse_iterator;
+		typedef std::ptrdiff_t									difference_type;
+		typedef size_t											size_type;
+
+		enum open_mode { read_write, read_only };
+	private:
+		static const size_t	header_bytes = sizeof(mapped_vector_header);
+
+		int			_fd;
+		bool		_read_only;
+		char		*_base;
+		size_t		_mapped;
+		pointer		_data;
+		size_type	_capacity;
+
+		mapped_vector (const mapped_vector&);
+		mapped_vector& operator=(const mapped_vector&);
+
+		static size_t page_round (size_t bytes)
+		{
+			static size_t page = 0;
+
+			if (page == 0)
+				page = (size_t)sysconf(_SC_PAGESIZE);
+			return ((bytes + page - 1) / page * page);
+		}
+
+		static void fail (const char *what)
+		{
+			throw std::runtime_error(std::string("mapped_vector: ") + what + ": " + std::strerror(errno));
+		}
+
+		mapped_vector_header* header() const
+		{
+			return (reinterpret_cast<mapped_vector_header*>(_base));
+		}
+
+		void set_mapping (void *base, size_t bytes)
+		{
+			_base = static_cast<char*>(base);
+			_mapped = bytes;
+			_data = reinterpret_cast<pointer>(_base + header_bytes);
+			_capacity = (bytes - header_bytes) / sizeof(value_type);
+		}
+
+		void writable() const
+		{
+			if (_base == NULL || _read_only)
+				throw std::logic_error("mapped_vector: not open for writing");
+		}
+
+		/* A read_only file is mapped PROT_READ: a write through a T& would fault. */
+		void mutable_access() const
+		{
+			if (_read_only)
+				throw std::logic_error("mapped_vector: read_only, read it through a const mapped_vector&");
+		}
+
+		/* Resizes file and mapping to bytes: the file grows first, or shrinks last. */
+		void remap (size_t bytes)
+		{
+			bytes = page_round(bytes);
+			if (bytes > _mapped && ftruncate(_fd, bytes) != 0)
+				fail("ftruncate");
+#ifdef MREMAP_MAYMOVE
+			void *base = mremap(_base, _mapped, bytes, MREMAP_MAYMOVE);
+			if (base == MAP_FAILED)
+				fail("mremap");
+#else
+			void *base = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+			if (base == MAP_FAILED)
+				fail("mmap");
+			munmap(_base, _mapped);
+#endif
+			if (bytes < _mapped && ftruncate(_fd, bytes) != 0)
+			{
+				set_mapping(base, bytes);
+				fail("ftruncate");
+			}
+			set_mapping(base, bytes);
+		}
+
+		void grow (size_type n)
+		{
+			if (n > max_size() - size())
+				throw std::length_error("error mapped_vector::max_size");
+			if (size() + n <= capacity())
+				return ;
+			reserve(ft::vector_growth<value_type>::next_capacity(size(), size() + n));
+		}
+
+		void set_size (size_type n)
+		{
+			__atomic_store_n(&header()->size, (unsigned long long)n, __ATOMIC_RELEASE);
+		}
+	public:
+		mapped_vector() : _fd(-1), _read_only(false), _base(NULL), _mapped(0), _data(NULL), _capacity(0) {}
+
+		explicit mapped_vector (const char *path, open_mode mode = read_write) :
+			_fd(-1), _read_only(false), _base(NULL), _mapped(0), _data(NULL), _capacity(0)
+		{
+			open(path, mode);
+		}
+
+#ifdef FT_CXX11
+		mapped_vector (mapped_vector&& x) noexcept : _fd(-1), _read_only(false), _base(NULL), _mapped(0),
+			_data(NULL), _capacity(0)
+		{
+			swap(x);
+		}
+
+		mapped_vector& operator= (mapped_vector&& x) noexcept
+		{
+			if (this != &x)
+			{
+				close();
+				swap(x);
+			}
+			return (*this);
+		}
+#endif
+
+		~mapped_vector()
+		{
+			close();
+		}
+
+		/*
+		** Maps path, creating it in read_write mode if it does not exist. A
+		** file written for another element size is refused.
+		*/
+		void open (const char *path, open_mode mode = read_write)
+		{
+			struct stat	st;
+			void		*base;
+
+			close();
+			_read_only = (mode == read_only);
+			_fd = ::open(path, _read_only ? O_RDONLY : O_RDWR | O_CREAT, 0644);
+			if (_fd < 0)
+				fail(path);
+			if (_read_only && flock(_fd, LOCK_SH) != 0)
+			{
+				close();
+				fail("flock");
+			}
+			if (fstat(_fd, &st) != 0)
+			{
+				close();
+				fail("fstat");
+			}
+			size_t bytes = (size_t)st.st_size;
+			bool fresh = (bytes == 0 && !_read_only);
+			if (fresh)
+			{
+				bytes = page_round(header_bytes);
+				if (ftruncate(_fd, bytes) != 0)
+				{
+					close();
+					fail("ftruncate");
+				}
+			}
+			if (bytes < header_bytes)
+			{
+				close();
+				throw std::runtime_error(std::string("mapped_vector: ") + path + ": not a mapped_vector file");
+			}
+			base = mmap(NULL, bytes, _read_only ? PROT_READ : PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+			if (base == MAP_FAILED)
+			{
+				close();
+				fail("mmap");
+			}
+			set_mapping(base, bytes);
+			if (fresh)
+			{
+				std::memcpy(header()->magic, "ftmapvec", 8);
+				header()->element_size = sizeof(value_type);
+				header()->size = 0;
+			}
+			if (std::memcmp(header()->magic, "ftmapvec", 8) != 0 || header()->element_size != sizeof(value_type)
+				|| __atomic_load_n(&header()->size, __ATOMIC_ACQUIRE) > _capacity)
+			{
+				close();
+				throw std::runtime_error(std::string("mapped_vector: ") + path + ": not a mapped_vector file of this element size");
+			}
+		}
+
+		/* Unmaps and closes the file; the elements stay in it. */
+		void close()
+		{
+			if (_base != NULL)
+				munmap(_base, _mapped);
+			if (_fd >= 0)
+				::close(_fd);
+			_fd = -1;
+			_base = NULL;
+			_mapped = 0;
+			_data = NULL;
+			_capacity = 0;
+		}
+
+		bool is_open() const
+		{
+			return (_base != NULL);
+		}
+
+		/* Writes the dirty pages back; async only schedules the write. */
+		void flush (bool async = false)
+		{
+			if (_base != NULL && msync(_base, _mapped, async ? MS_ASYNC : MS_SYNC) != 0)
+				fail("msync");
+		}
+
+		size_type size() const
+		{
+			if (_base == NULL)
+				return (0);
+			size_type n = __atomic_load_n(&header()->size, __ATOMIC_ACQUIRE);
+			return (n < _capacity ? n : _capacity);
+		}
+
+		size_type capacity() const
+		{
+			return (_capacity);
+		}
+
+		size_type max_size() const
+		{
+			return (((size_type)-1 / 2 - header_bytes) / sizeof(value_type));
+		}
+
+		bool empty() const
+		{
+			return (size() == 0);
+		}
+
+		pointer data()
+		{
+			mutable_access();
+			return (_data);
+		}
+
+		const_pointer data() const
+		{
+			return (_data);
+		}
+
+		iterator begin()
+		{
+			mutable_access();
+			return (iterator(_data));
+		}
+
+		const_iterator begin() const
+		{
+			return (const_iterator(_data));
+		}
+
+		iterator end()
+		{
+			mutable_access();
+			return (iterator(_data + size()));
+		}
+
+		const_iterator end() const
+		{
+			return (const_iterator(_data + size()));
+		}
+
+		reverse_iterator rbegin()
+		{
+			return (reverse_iterator(end()));
+		}
+
+		const_reverse_iterator rbegin() const
+		{
+			return (const_reverse_iterator(end()));
+		}
+
+		reverse_iterator rend()
+		{
+			return (reverse_iterator(begin()));
+		}
+
+		const_reverse_iterator rend() const
+		{
+			return (const_reverse_iterator(begin()));
+		}
+
+		void reserve (size_type n)
+		{
+			writable();
+			if (n > max_size())
+				throw std::length_error("error mapped_vector::max_size");
+			if (n > capacity())
+				remap(header_bytes + n * sizeof(value_type));
+		}
+
+		/*
+		** Truncates the file to the pages the elements need. While a reader
+		** has the file open it does nothing, since the reader would fault on
+		** the pages past the new end.
+		*/
+		void shrink_to_fit()
+		{
+			writable();
+			if (page_round(header_bytes + size() * sizeof(value_type)) >= _mapped)
+				return ;
+			if (flock(_fd, LOCK_EX | LOCK_NB) != 0)
+			{
+				if (errno == EWOULDBLOCK)
+					return ;
+				fail("flock");
+			}
+			try
+			{
+				remap(header_bytes + size() * sizeof(value_type));
+			}
+			catch (...)
+			{
+				flock(_fd, LOCK_UN);
+				throw ;
+			}
+			flock(_fd, LOCK_UN);
+		}
+
+		void resize (size_type n, value_type val = value_type())
+		{
+			writable();
+			if (n > size())
+			{
+				grow(n - size());
+				for (size_type i = size(); i != n; i++)
+					_data[i] = val;
+			}
+			set_size(n);
+		}
+
+		void push_back (const value_type& val)
+		{
+			writable();
+			size_type n = size();
+			if (n == _capacity)
+			{
+				value_type copy(val);
+				grow(1);
+				_data[n] = copy;
+			}
+			else
+				_data[n] = val;
+			set_size(n + 1);
+		}
+
+		void pop_back()
+		{
+			writable();
+			set_size(size() - 1);
+		}
+
+		iterator insert (iterator position, const value_type& val)
+		{
+			writable();
+			difference_type	offset = position.base() - _data;
+			value_type		copy(val);
+			size_type		n = size();
+
+			grow(1);
+			std::memmove(static_cast<void*>(_data + offset + 1), static_cast<const void*>(_data + offset),
+						 (n - offset) * sizeof(value_type));
+			_data[offset] = copy;
+			set_size(n + 1);
+			return (iterator(_data + offset));
+		}
+
+		iterator erase (iterator position)
+		{
+			return (erase(position, position + 1));
+		}
+
+		iterator erase (iterator first, iterator last)
+		{
+			writable();
+			pointer	left = first.base();
+			pointer	right = last.base();
+
+			std::memmove(static_cast<void*>(left), static_cast<const void*>(right), (_data + size() - right) * sizeof(value_type));
+			set_size(size() - (right - left));
+			return (first);
+		}
+
+		template <class InputIterator>
+		void assign (InputIterator first, InputIterator last,
+					 typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL)
+		{
+			clear();
+			for (; first != last; first++)
+				push_back(*first);
+		}
+
+		void clear()
+		{
+			writable();
+			set_size(0);
+		}
+
+		void swap (mapped_vector& x)
+		{
+			std::swap(_fd, x._fd);
+			std::swap(_read_only, x._read_only);
+			std::swap(_base, x._base);
+			std::swap(_mapped, x._mapped);
+			std::swap(_data, x._data);
+			std::swap(_capacity, x._capacity);
+		}
+
+		reference operator[] (size_type n)
+		{
+			mutable_access();
+			return (_data[n]);
+		}
+
+		const_reference operator[] (size_type n) const
+		{
+			return (_data[n]);
+		}
+
+		reference at (size_type n)
+		{
+			mutable_access();
+			if (n >= size())
+				throw std::out_of_range("mapped_vector::at");
+			return (_data[n]);
+		}
+
+		const_reference at (size_type n) const
+		{
+			if (n >= size())
+				throw std::out_of_range("mapped_vector::at");
+			return (_data[n]);
+		}
+
+		reference front()
+		{
+			mutable_access();
+			return (_data[0]);
+		}
+
+		const_reference front() const
+		{
+			return (_data[0]);
+		}
+
+		reference back()
+		{
+			mutable_access();
+			return (_data[size() - 1]);
+		}
+
+		const_reference back() const
+		{
+			return (_data[size() - 1]);
+		}
+	};
+
+	template <class T>
+	void swap (mapped_vector<T>& x, mapped_vector<T>& y)
+	{
+		x.swap(y);
+	}
+}
+
+#endif
@@ -0,0 +1,170 @@
+#pragma once
+#ifndef MMAP_ALLOCATOR_HPP
+#define MMAP_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "utils.hpp"
+
+namespace ft
+{
+	/*
+	** Allocator for big buffers of trivially copyable data. Blocks of at least
+	** Threshold bytes are mapped straight from the kernel, and reallocate()
+	** grows them with mremap, which moves page table entries instead of bytes:
+	** no copy, and no second buffer alive while it happens. Smaller blocks go
+	** through operator new. With HugePages set, mapped blocks are advised as
+	** MADV_HUGEPAGE so transparent huge pages can back them.
+	*/
+	template <class T, size_t Threshold = 1024 * 1024, bool HugePages = false>
+	class mmap_allocator
+	{
+	public:
+		typedef T				value_type;
+		typedef T*				pointer;
+		typedef const T*		const_pointer;
+		typedef T&				reference;
+		typedef const T&		const_reference;
+		typedef size_t			size_type;
+		typedef std::ptrdiff_t	difference_type;
+
+		template <class U>
+		struct rebind { typedef mmap_allocator<U, Threshold, HugePages> other; };
+
+		static const size_t	threshold = Threshold;
+	private:
+		static size_t page_round (size_t bytes)
+		{
+			static size_t page = 0;
+
+			if (page == 0)
+				page = (size_t)sysconf(_SC_PAGESIZE);
+			return ((bytes + page - 1) / page * page);
+		}
+
+		static bool is_mapped (size_type n)
+		{
+			return (n * sizeof(T) >= Threshold);
+		}
+
+		static void advise (void *p, size_t bytes)
+		{
+#ifdef MADV_HUGEPAGE
+			if (HugePages)
+				madvise(p, bytes, MADV_HUGEPAGE);
+#else
+			(void)p;
+			(void)bytes;
+#endif
+		}
+	public:
+		mmap_allocator() {}
+		template <class U>
+		mmap_allocator(const mmap_allocator<U, Threshold, HugePages>&) {}
+
+		pointer address (reference x) const
+		{
+			return (&x);
+		}
+
+		const_pointer address (const_reference x) const
+		{
+			return (&x);
+		}
+
+		size_type max_size() const
+		{
+			return ((size_type)-1 / sizeof(T));
+		}
+
+		pointer allocate (size_type n, const void* = 0)
+		{
+			if (n > max_size())
+				throw std::bad_alloc();
+			if (!is_mapped(n))
+				return (static_cast<pointer>(::operator new(n * sizeof(T))));
+			size_t bytes = page_round(n * sizeof(T));
+			void *p = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (p == MAP_FAILED)
+				throw std::bad_alloc();
+			advise(p, bytes);
+			return (static_cast<pointer>(p));
+		}
+
+		void deallocate (pointer p, size_type n)
+		{
+			if (p == NULL)
+				return ;
+			if (!is_mapped(n))
+				::operator delete(p);
+			else
+				munmap(p, page_round(n * sizeof(T)));
+		}
+
+		/*
+		** Resizes the block p of old_n elements to new_n and returns where it
+		** now lives; the first min(old_n, new_n) elements keep their bytes.
+		** Only meaningful for trivially copyable T.
+		*/
+		pointer reallocate (pointer p, size_type old_n, size_type new_n)
+		{
+			if (p == NULL)
+				return (allocate(new_n));
+			if (new_n > max_size())
+				throw std::bad_alloc();
+#ifdef MREMAP_MAYMOVE
+			if (is_mapped(old_n) && is_mapped(new_n))
+			{
+				size_t old_bytes = page_round(old_n * sizeof(T));
+				size_t new_bytes = page_round(new_n * sizeof(T));
+				if (old_bytes == new_bytes)
+					return (p);
+				void *res = mremap(p, old_bytes, new_bytes, MREMAP_MAYMOVE);
+				if (res == MAP_FAILED)
+					throw std::bad_alloc();
+				advise(res, new_bytes);
+				return (static_cast<pointer>(res));
+			}
+#endif
+			pointer res = allocate(new_n);
+			std::memcpy(static_cast<void*>(res), static_cast<const void*>(p), (old_n < new_n ? old_n : new_n) * sizeof(T));
+			deallocate(p, old_n);
+			return (res);
+		}
+
+		void construct (pointer p, const_reference val)
+		{
+			new (static_cast<void*>(p)) T(val);
+		}
+
+#ifdef FT_CXX11
+		template <class U, class... Args>
+		void construct (U* p, Args&&... args)
+		{
+			new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+		}
+#endif
+
+		void destroy (pointer p)
+		{
+			p->~T();
+		}
+	};
+
+	template <class T, size_t Threshold, bool HugePages, class U>
+	bool operator== (const mmap_allocator<T, Threshold, HugePages>&, const mmap_allocator<U, Threshold, HugePages>&)
+	{
+		return (true);
+	}
+
+	template <class T, size_t Threshold, bool HugePages, class U>
+	bool operator!= (const mmap_allocator<T, Threshold, HugePages>&, const mmap_allocator<U, Threshold, HugePages>&)
+	{
+		return (false);
+	}
+}
+
+#endif
@@ -0,0 +1,568 @@
+#pragma once
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#include <cstddef>
+#include <sched.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "iterator.hpp"
+#include "utils.hpp"
+#include "vector.hpp"
+
+namespace ft
+{
+	namespace parallel
+	{
+		/* Elements per leaf task when the caller does not pick a grain. */
+		static const size_t	default_grain = 16384;
+
+		/*
+		** Fixed set of pthreads that run index ranges [0, n) through a callback.
+		** Every worker owns a deque of ranges: it splits its current range in
+		** halves down to the grain, keeps the left half and pushes the right
+		** one on the back of its deque, and pops from the back when it runs
+		** out. Idle workers steal from the front of the other deques, where the
+		** oldest and biggest ranges sit, so one steal moves a lot of work. The
+		** thread calling run() works as worker 0 and returns once every index
+		** has been processed. The callback must not throw.
+		*/
+		class thread_pool
+		{
+		public:
+			typedef void	(*task_fn)(void *ctx, size_t first, size_t last);
+		private:
+			struct range
+			{
+				size_t	first;
+				size_t	last;
+			};
+
+			struct queue
+			{
+				pthread_mutex_t		lock;
+				ft::vector<range>	items;
+				size_t				head;
+			};
+
+			struct job
+			{
+				task_fn			fn;
+				void			*ctx;
+				size_t			grain;
+				size_t			remaining;
+			};
+
+			struct worker_arg
+			{
+				thread_pool	*pool;
+				size_t		self;
+			};
+
+			size_t					_size;
+			queue					*_queues;
+			ft::vector<pthread_t>	_ids;
+			ft::vector<worker_arg>	_args;
+			pthread_mutex_t			_lock;
+			pthread_cond_t			_wake;
+			pthread_cond_t			_done;
+			job						*_job;
+			unsigned long			_generation;
+			size_t					_busy;
+			bool					_stop;
+
+			thread_pool (const thread_pool&);
+			thread_pool& operator=(const thread_pool&);
+
+			void push (size_t self, size_t first, size_t last)
+			{
+				queue	&q = _queues[self];
+				range	r;
+
+				r.first = first;
+				r.last = last;
+				pthread_mutex_lock(&q.lock);
+				q.items.push_back(r);
+				pthread_mutex_unlock(&q.lock);
+			}
+
+			bool pop (size_t self, range& r)
+			{
+				queue	&q = _queues[self];
+				bool	found = false;
+
+				pthread_mutex_lock(&q.lock);
+				if (q.items.size() > q.head)
+				{
+					r = q.items.back();
+					q.items.pop_back();
+					found = true;
+				}
+				if (q.items.size() == q.head)
+				{
+					q.items.clear();
+					q.head = 0;
+				}
+				pthread_mutex_unlock(&q.lock);
+				return (found);
+			}
+
+			bool steal (size_t self, range& r)
+			{
+				for (size_t i = 1; i != _size; i++)
+				{
+					queue	&q = _queues[(self + i) % _size];
+					bool	found = false;
+
+					pthread_mutex_lock(&q.lock);
+					if (q.items.size() > q.head)
+					{
+						r = q.items[q.head++];
+						found = true;
+					}
+					pthread_mutex_unlock(&q.lock);
+					if (found)
+						return (true);
+				}
+				return (false);
+			}
+
+			void work (size_t self, job& j)
+			{
+				range	r;
+
+				while (__atomic_load_n(&j.remaining, __ATOMIC_ACQUIRE) != 0)
+				{
+					if (!pop(self, r) && !steal(self, r))
+					{
+						sched_yield();
+						continue ;
+					}
+					while (r.last - r.first > j.grain)
+					{
+						size_t mid = r.first + (r.last - r.first) / 2;
+						push(self, mid, r.last);
+						r.last = mid;
+					}
+					j.fn(j.ctx, r.first, r.last);
+					__sync_fetch_and_sub(&j.remaining, r.last - r.first);
+				}
+			}
+
+			static void *worker_main (void *arg)
+			{
+				worker_arg		*a = static_cast<worker_arg*>(arg);
+				thread_pool		*pool = a->pool;
+				unsigned long	seen = 0;
+
+				pthread_mutex_lock(&pool->_lock);
+				for (;;)
+				{
+					while (!pool->_stop && pool->_generation == seen)
+						pthread_cond_wait(&pool->_wake, &pool->_lock);
+					if (pool->_stop)
+						break ;
+					seen = pool->_generation;
+					job *j = pool->_job;
+					if (j == NULL)
+						continue ;
+					pool->_busy++;
+					pthread_mutex_unlock(&pool->_lock);
+					pool->work(a->self, *j);
+					pthread_mutex_lock(&pool->_lock);
+					if (--pool->_busy == 0)
+						pthread_cond_signal(&pool->_done);
+				}
+				pthread_mutex_unlock(&pool->_lock);
+				return (NULL);
+			}
+		public:
+			/* Number of online CPUs, at least 1. */
+			static size_t hardware_threads()
+			{
+				long n = sysconf(_SC_NPROCESSORS_ONLN);
+				return (n > 0 ? (size_t)n : 1);
+			}
+
+			/*
+			** Starts threads - 1 workers (hardware_threads() when 0). A worker
+			** that fails to start is simply missing: its queue is still drained
+			** by the others.
+			*/
+			explicit thread_pool (size_t threads = 0) :
+				_size(threads == 0 ? hardware_threads() : threads), _queues(NULL), _ids(), _args(),
+				_job(NULL), _generation(0), _busy(0), _stop(false)
+			{
+				pthread_mutex_init(&_lock, NULL);
+				pthread_cond_init(&_wake, NULL);
+				pthread_cond_init(&_done, NULL);
+				_queues = new queue[_size];
+				for (size_t i = 0; i != _size; i++)
+				{
+					pthread_mutex_init(&_queues[i].lock, NULL);
+					_queues[i].head = 0;
+				}
+				_args.resize(_size);
+				_ids.reserve(_size);
+				for (size_t i = 1; i < _size; i++)
+				{
+					pthread_t	id;
+
+					_args[i].pool = this;
+					_args[i].self = i;
+					if (pthread_create(&id, NULL, &thread_pool::worker_main, &_args[i]) == 0)
+						_ids.push_back(id);
+				}
+			}
+
+			~thread_pool()
+			{
+				pthread_mutex_lock(&_lock);
+				_stop = true;
+				pthread_cond_broadcast(&_wake);
+				pthread_mutex_unlock(&_lock);
+				for (size_t i = 0; i != _ids.size(); i++)
+					pthread_join(_ids[i], NULL);
+				for (size_t i = 0; i != _size; i++)
+					pthread_mutex_destroy(&_queues[i].lock);
+				delete [] _queues;
+				pthread_cond_destroy(&_done);
+				pthread_cond_destroy(&_wake);
+				pthread_mutex_destroy(&_lock);
+			}
+
+			/* Threads taking part in run(), the caller included. */
+			size_t size() const
+			{
+				return (_size);
+			}
+
+			/*
+			** Calls fn(ctx, first, last) over disjoint ranges covering [0, n),
+			** none longer than grain, and returns when all of them are done.
+			** Not reentrant: fn must not call run() on the same pool.
+			*/
+			void run (size_t n, size_t grain, task_fn fn, void *ctx)
+			{
+				if (n == 0)
+					return ;
+				if (grain == 0)
+					grain = 1;
+				if (_ids.empty() || n <= grain)
+				{
+					for (size_t first = 0; first < n; first += grain)
+						fn(ctx, first, (n - first < grain ? n : first + grain));
+					return ;
+				}
+				job	j;
+
+				j.fn = fn;
+				j.ctx = ctx;
+				j.grain = grain;
+				j.remaining = n;
+				for (size_t i = 0; i != _size; i++)
+				{
+					size_t first = n / _size * i;
+					size_t last = (i + 1 == _size ? n : n / _size * (i + 1));
+					if (first != last)
+						push(i, first, last);
+				}
+				pthread_mutex_lock(&_lock);
+				_job = &j;
+				_generation++;
+				pthread_cond_broadcast(&_wake);
+				pthread_mutex_unlock(&_lock);
+				work(0, j);
+				pthread_mutex_lock(&_lock);
+				while (_busy != 0)
+					pthread_cond_wait(&_done, &_lock);
+				_job = NULL;
+				pthread_mutex_unlock(&_lock);
+			}
+		};
+
+		template <class RandomIt, class UnaryFunction>
+		struct for_each_task
+		{
+			RandomIt		first;
+			UnaryFunction	*f;
+
+			static void run (void *ctx, size_t b, size_t e)
+			{
+				for_each_task	*t = static_cast<for_each_task*>(ctx);
+				UnaryFunction	f = *t->f;
+
+				for (size_t i = b; i != e; i++)
+					f(t->first[i]);
+			}
+		};
+
+		template <class RandomIt, class OutputIt, class UnaryOperation>
+		struct transform_task
+		{
+			RandomIt		first;
+			OutputIt		out;
+			UnaryOperation	*op;
+
+			static void run (void *ctx, size_t b, size_t e)
+			{
+				transform_task	*t = static_cast<transform_task*>(ctx);
+				UnaryOperation	op = *t->op;
+
+				for (size_t i = b; i != e; i++)
+					t->out[i] = op(t->first[i]);
+			}
+		};
+
+		/* Reduces (or scans) whole blocks of `block` elements, one per index. */
+		template <class RandomIt, class T, class BinaryOperation>
+		struct block_task
+		{
+			RandomIt		first;
+			size_t			n;
+			size_t			block;
+			T				*sums;
+			BinaryOperation	*op;
+
+			static void reduce (void *ctx, size_t b, size_t e)
+			{
+				block_task		*t = static_cast<block_task*>(ctx);
+				BinaryOperation	op = *t->op;
+
+				for (size_t k = b; k != e; k++)
+				{
+					size_t	i = k * t->block;
+					size_t	end = (t->n - i < t->block ? t->n : i + t->block);
+					T		acc = t->first[i];
+
+					for (i++; i != end; i++)
+						acc = op(acc, t->first[i]);
+					t->sums[k] = acc;
+				}
+			}
+		};
+
+		template <class RandomIt, class OutputIt, class T, class BinaryOperation>
+		struct scan_task
+		{
+			RandomIt		first;
+			OutputIt		out;
+			size_t			n;
+			size_t			block;
+			const T			*offsets;
+			BinaryOperation	*op;
+
+			static void run (void *ctx, size_t b, size_t e)
+			{
+				scan_task		*t = static_cast<scan_task*>(ctx);
+				BinaryOperation	op = *t->op;
+
+				for (size_t k = b; k != e; k++)
+				{
+					size_t	i = k * t->block;
+					size_t	end = (t->n - i < t->block ? t->n : i + t->block);
+					T		acc = (k == 0 ? T(t->first[i]) : op(t->offsets[k - 1], t->first[i]));
+
+					t->out[i] = acc;
+					for (i++; i != end; i++)
+					{
+						acc = op(acc, t->first[i]);
+						t->out[i] = acc;
+					}
+				}
+			}
+		};
+
+		template <class RandomIt, class UnaryPredicate>
+		struct find_if_task
+		{
+			RandomIt		first;
+			UnaryPredicate	*pred;
+			size_t			found;
+
+			static void run (void *ctx, size_t b, size_t e)
+			{
+				find_if_task	*t = static_cast<find_if_task*>(ctx);
+				UnaryPredicate	pred = *t->pred;
+
+				for (size_t i = b; i != e && i < __atomic_load_n(&t->found, __ATOMIC_RELAXED); i++)
+				{
+					if (pred(t->first[i]))
+					{
+						size_t cur = __atomic_load_n(&t->found, __ATOMIC_RELAXED);
+						while (i < cur)
+						{
+							size_t prev = __sync_val_compare_and_swap(&t->found, cur, i);
+							if (prev == cur)
+								break ;
+							cur = prev;
+						}
+						return ;
+					}
+				}
+			}
+		};
+
+		template <class RandomIt, class UnaryPredicate>
+		struct count_if_task
+		{
+			RandomIt		first;
+			UnaryPredicate	*pred;
+			size_t			count;
+
+			static void run (void *ctx, size_t b, size_t e)
+			{
+				count_if_task	*t = static_cast<count_if_task*>(ctx);
+				UnaryPredicate	pred = *t->pred;
+				size_t			n = 0;
+
+				for (size_t i = b; i != e; i++)
+					if (pred(t->first[i]))
+						n++;
+				__sync_fetch_and_add(&t->count, n);
+			}
+		};
+
+		/*
+		** Each leaf range works on its own copy of the function object, so f
+		** may keep per-call state but must not rely on seeing every element.
+		*/
+		template <class RandomIt, class UnaryFunction>
+		void for_each (thread_pool& pool, RandomIt first, RandomIt last, UnaryFunction f, size_t grain = default_grain)
+		{
+			for_each_task<RandomIt, UnaryFunction>	t;
+
+			t.first = first;
+			t.f = &f;
+			pool.run(last - first, grain, &for_each_task<RandomIt, UnaryFunction>::run, &t);
+		}
+
+		template <class RandomIt, class OutputIt, class UnaryOperation>
+		OutputIt transform (thread_pool& pool, RandomIt first, RandomIt last, OutputIt out, UnaryOperation op,
+			size_t grain = default_grain)
+		{
+			transform_task<RandomIt, OutputIt, UnaryOperation>	t;
+			size_t												n = last - first;
+
+			t.first = first;
+			t.out = out;
+			t.op = &op;
+			pool.run(n, grain, &transform_task<RandomIt, OutputIt, UnaryOperation>::run, &t);
+			return (out + n);
+		}
+
+		/* op must be associative; blocks are combined left to right. */
+		template <class RandomIt, class T, class BinaryOperation>
+		T reduce (thread_pool& pool, RandomIt first, RandomIt last, T init, BinaryOperation op,
+			size_t grain = default_grain)
+		{
+			size_t	n = last - first;
+
+			if (n == 0)
+				return (init);
+			if (grain == 0)
+				grain = 1;
+			size_t											blocks = (n + grain - 1) / grain;
+			ft::vector<T>									sums(blocks, init);
+			block_task<RandomIt, T, BinaryOperation>		t;
+
+			t.first = first;
+			t.n = n;
+			t.block = grain;
+			t.sums = &sums[0];
+			t.op = &op;
+			pool.run(blocks, 1, &block_task<RandomIt, T, BinaryOperation>::reduce, &t);
+			for (size_t k = 0; k != blocks; k++)
+				init = op(init, sums[k]);
+			return (init);
+		}
+
+		template <class RandomIt, class T>
+		T reduce (thread_pool& pool, RandomIt first, RandomIt last, T init)
+		{
+			return (ft::parallel::reduce(pool, first, last, init, ft::plus<T>()));
+		}
+
+		/*
+		** Two passes: block totals in parallel, a serial prefix over the
+		** totals, then every block scanned again from its offset. Costs about
+		** two reads per element instead of one, and pays off from 2 threads up.
+		*/
+		template <class RandomIt, class OutputIt, class BinaryOperation>
+		OutputIt inclusive_scan (thread_pool& pool, RandomIt first, RandomIt last, OutputIt out, BinaryOperation op,
+			size_t grain = default_grain)
+		{
+			typedef typename ft::iterator_traits<RandomIt>::value_type	T;
+			size_t														n = last - first;
+
+			if (n == 0)
+				return (out);
+			if (grain == 0)
+				grain = 1;
+			size_t										blocks = (n + grain - 1) / grain;
+			ft::vector<T>								sums(blocks);
+			block_task<RandomIt, T, BinaryOperation>	b;
+
+			b.first = first;
+			b.n = n;
+			b.block = grain;
+			b.sums = &sums[0];
+			b.op = &op;
+			if (blocks > 1)
+				pool.run(blocks - 1, 1, &block_task<RandomIt, T, BinaryOperation>::reduce, &b);
+			for (size_t k = 1; k < blocks; k++)
+				sums[k] = op(sums[k - 1], sums[k]);
+			scan_task<RandomIt, OutputIt, T, BinaryOperation>	s;
+
+			s.first = first;
+			s.out = out;
+			s.n = n;
+			s.block = grain;
+			s.offsets = &sums[0];
+			s.op = &op;
+			pool.run(blocks, 1, &scan_task<RandomIt, OutputIt, T, BinaryOperation>::run, &s);
+			return (out + n);
+		}
+
+		template <class RandomIt, class OutputIt>
+		OutputIt inclusive_scan (thread_pool& pool, RandomIt first, RandomIt last, OutputIt out)
+		{
+			typedef typename ft::iterator_traits<RandomIt>::value_type	T;
+
+			return (ft::parallel::inclusive_scan(pool, first, last, out, ft::plus<T>()));
+		}
+
+		/*
+		** Returns the first match, like the serial find_if. Ranges past the
+		** best match found so far stop early.
+		*/
+		template <class RandomIt, class UnaryPredicate>
+		RandomIt find_if (thread_pool& pool, RandomIt first, RandomIt last, UnaryPredicate pred,
+			size_t grain = default_grain)
+		{
+			find_if_task<RandomIt, UnaryPredicate>	t;
+			size_t									n = last - first;
+
+			t.first = first;
+			t.pred = &pred;
+			t.found = n;
+			pool.run(n, grain, &find_if_task<RandomIt, UnaryPredicate>::run, &t);
+			return (first + t.found);
+		}
+
+		template <class RandomIt, class UnaryPredicate>
+		typename ft::iterator_traits<RandomIt>::difference_type
+		count_if (thread_pool& pool, RandomIt first, RandomIt last, UnaryPredicate pred, size_t grain = default_grain)
+		{
+			count_if_task<RandomIt, UnaryPredicate>	t;
+
+			t.first = first;
+			t.pred = &pred;
+			t.count = 0;
+			pool.run(last - first, grain, &count_if_task<RandomIt, UnaryPredicate>::run, &t);
+			return (t.count);
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,385 @@
+#pragma once
+#ifndef SIMD_HPP
+#define SIMD_HPP
+
+#include <cstddef>
+#include <cstring>
+
+/*
+** Vector kernels used by the algorithms in utils.hpp. On x86 with gcc/clang
+** the widest kernel the CPU supports is picked once at run time (AVX2, else
+** SSE2); everywhere else, or with FT_NO_SIMD defined, a word-at-a-time scalar
+** loop does the same job.
+*/
+#if !defined(FT_NO_SIMD) && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+# define FT_SIMD_X86 1
+# include <immintrin.h>
+#endif
+
+namespace ft
+{
+	namespace simd
+	{
+		typedef size_t (*mismatch_fn)(const unsigned char*, const unsigned char*, size_t);
+
+		/* Index of the first byte where a and b differ, or n if they do not. */
+		inline size_t mismatch_scalar (const unsigned char *a, const unsigned char *b, size_t n)
+		{
+			size_t	i = 0;
+
+			for (; i + sizeof(size_t) <= n; i += sizeof(size_t))
+			{
+				size_t	x;
+				size_t	y;
+
+				std::memcpy(&x, a + i, sizeof(size_t));
+				std::memcpy(&y, b + i, sizeof(size_t));
+				if (x != y)
+					break ;
+			}
+			while (i < n && a[i] == b[i])
+				i++;
+			return (i);
+		}
+
+#ifdef FT_SIMD_X86
+		__attribute__((target("sse2")))
+		inline size_t mismatch_sse2 (const unsigned char *a, const unsigned char *b, size_t n)
+		{
+			size_t	i = 0;
+
+			for (; i + 16 <= n; i += 16)
+			{
+				__m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+				__m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+				unsigned mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb));
+				if (mask != 0xffffu)
+					return (i + __builtin_ctz(~mask));
+			}
+			return (i + mismatch_scalar(a + i, b + i, n - i));
+		}
+
+		__attribute__((target("avx2")))
+		inline size_t mismatch_avx2 (const unsigned char *a, const unsigned char *b, size_t n)
+		{
+			size_t	i = 0;
+
+			for (; i + 64 <= n; i += 64)
+			{
+				__m256i lo = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)),
+											   _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i)));
+				__m256i hi = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i + 32)),
+											   _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i + 32)));
+				if ((unsigned)_mm256_movemask_epi8(_mm256_and_si256(lo, hi)) != 0xffffffffu)
+					break ;
+			}
+			for (; i + 32 <= n; i += 32)
+			{
+				__m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+				__m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+				unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb));
+				if (mask != 0xffffffffu)
+					return (i + __builtin_ctz(~mask));
+			}
+			return (i + mismatch_sse2(a + i, b + i, n - i));
+		}
+#endif
+
+		inline mismatch_fn select_mismatch()
+		{
+#ifdef FT_SIMD_X86
+			__builtin_cpu_init();
+			if (__builtin_cpu_supports("avx2"))
+				return (&mismatch_avx2);
+			if (__builtin_cpu_supports("sse2"))
+				return (&mismatch_sse2);
+#endif
+			return (&mismatch_scalar);
+		}
+
+		/*
+		** Equal 4KB blocks are skipped with memcmp, which libc already tunes per
+		** CPU; the kernel only pinpoints the first difference inside a block.
+		*/
+		inline size_t mismatch (const void *a, const void *b, size_t n)
+		{
+			static const mismatch_fn	fn = select_mismatch();
+			const unsigned char			*pa = static_cast<const unsigned char*>(a);
+			const unsigned char			*pb = static_cast<const unsigned char*>(b);
+			size_t						i = 0;
+
+			while (i + 4096 <= n && std::memcmp(pa + i, pb + i, 4096) == 0)
+				i += 4096;
+			return (i + fn(pa + i, pb + i, n - i));
+		}
+
+		typedef size_t (*popcount_fn)(const unsigned long*, size_t);
+
+		/* Number of set bits in words[0 .. n). */
+		inline size_t popcount_scalar (const unsigned long *words, size_t n)
+		{
+			size_t	count = 0;
+
+			for (size_t i = 0; i != n; i++)
+				count += __builtin_popcountl(words[i]);
+			return (count);
+		}
+
+#ifdef FT_SIMD_X86
+		/* Same loop, but __builtin_popcountl becomes the popcnt instruction. */
+		__attribute__((target("popcnt")))
+		inline size_t popcount_hw (const unsigned long *words, size_t n)
+		{
+			size_t	c0 = 0;
+			size_t	c1 = 0;
+			size_t	c2 = 0;
+			size_t	c3 = 0;
+			size_t	i = 0;
+
+			for (; i + 4 <= n; i += 4)
+			{
+				c0 += __builtin_popcountl(words[i]);
+				c1 += __builtin_popcountl(words[i + 1]);
+				c2 += __builtin_popcountl(words[i + 2]);
+				c3 += __builtin_popcountl(words[i + 3]);
+			}
+			for (; i != n; i++)
+				c0 += __builtin_popcountl(words[i]);
+			return (c0 + c1 + c2 + c3);
+		}
+#endif
+
+		inline popcount_fn select_popcount()
+		{
+#ifdef FT_SIMD_X86
+			__builtin_cpu_init();
+			if (__builtin_cpu_supports("popcnt"))
+				return (&popcount_hw);
+#endif
+			return (&popcount_scalar);
+		}
+
+		inline size_t popcount (const unsigned long *words, size_t n)
+		{
+			static const popcount_fn	fn = select_popcount();
+
+			return (fn(words, n));
+		}
+
+		/* Word operations for bitwise(): dst[i] = op(dst[i], src[i]). */
+		struct bit_and
+		{
+			static unsigned long word (unsigned long a, unsigned long b) { return (a & b); }
+#ifdef FT_SIMD_X86
+			__attribute__((target("avx2")))
+			static __m256i vec (__m256i a, __m256i b) { return (_mm256_and_si256(a, b)); }
+#endif
+		};
+
+		struct bit_or
+		{
+			static unsigned long word (unsigned long a, unsigned long b) { return (a | b); }
+#ifdef FT_SIMD_X86
+			__attribute__((target("avx2")))
+			static __m256i vec (__m256i a, __m256i b) { return (_mm256_or_si256(a, b)); }
+#endif
+		};
+
+		struct bit_xor
+		{
+			static unsigned long word (unsigned long a, unsigned long b) { return (a ^ b); }
+#ifdef FT_SIMD_X86
+			__attribute__((target("avx2")))
+			static __m256i vec (__m256i a, __m256i b) { return (_mm256_xor_si256(a, b)); }
+#endif
+		};
+
+		typedef void (*bitwise_fn)(unsigned long*, const unsigned long*, size_t);
+
+		template <class Op>
+		void bitwise_scalar (unsigned long *dst, const unsigned long *src, size_t n)
+		{
+			for (size_t i = 0; i != n; i++)
+				dst[i] = Op::word(dst[i], src[i]);
+		}
+
+#ifdef FT_SIMD_X86
+		template <class Op>
+		__attribute__((target("avx2")))
+		void bitwise_avx2 (unsigned long *dst, const unsigned long *src, size_t n)
+		{
+			size_t	i = 0;
+
+			for (; i + 8 <= n; i += 8)
+			{
+				__m256i *d = reinterpret_cast<__m256i*>(dst + i);
+				const __m256i *s = reinterpret_cast<const __m256i*>(src + i);
+				_mm256_storeu_si256(d, Op::vec(_mm256_loadu_si256(d), _mm256_loadu_si256(s)));
+				_mm256_storeu_si256(d + 1, Op::vec(_mm256_loadu_si256(d + 1), _mm256_loadu_si256(s + 1)));
+			}
+			for (; i != n; i++)
+				dst[i] = Op::word(dst[i], src[i]);
+		}
+#endif
+
+		template <class Op>
+		bitwise_fn select_bitwise()
+		{
+#ifdef FT_SIMD_X86
+			__builtin_cpu_init();
+			if (sizeof(unsigned long) == 8 && __builtin_cpu_supports("avx2"))
+				return (&bitwise_avx2<Op>);
+#endif
+			return (&bitwise_scalar<Op>);
+		}
+
+		/* dst[i] = Op::word(dst[i], src[i]) for i in [0, n). */
+		template <class Op>
+		void bitwise (unsigned long *dst, const unsigned long *src, size_t n)
+		{
+			static const bitwise_fn	fn = select_bitwise<Op>();
+
+			fn(dst, src, n);
+		}
+
+		typedef size_t (*remove_fn)(void*, size_t, const void*);
+
+		/*
+		** Stable in-place removal of the Size-byte elements equal to *value from
+		** data[0 .. n); returns how many are left. Every element is copied down,
+		** and the output only moves past the ones kept: no branch to mispredict.
+		*/
+		template <size_t Size>
+		size_t remove_equal_scalar (void *data, size_t n, const void *value)
+		{
+			unsigned char	*p = static_cast<unsigned char*>(data);
+			size_t			out = 0;
+
+			for (size_t i = 0; i != n; i++)
+			{
+				bool drop = std::memcmp(p + i * Size, value, Size) == 0;
+				std::memmove(p + out * Size, p + i * Size, Size);
+				out += !drop;
+			}
+			return (out);
+		}
+
+#ifdef FT_SIMD_X86
+		/*
+		** Lane permutations for _mm256_permutevar8x32_epi32: entry m gathers the
+		** 32-bit lanes whose bit is set in m to the front, in order.
+		*/
+		struct compress_table
+		{
+			int	lanes[256][8];
+
+			compress_table()
+			{
+				for (int m = 0; m != 256; m++)
+				{
+					int k = 0;
+					for (int lane = 0; lane != 8; lane++)
+						if (m & (1 << lane))
+							lanes[m][k++] = lane;
+					while (k != 8)
+						lanes[m][k++] = 0;
+				}
+			}
+		};
+
+		inline const compress_table& compress_lanes()
+		{
+			static const compress_table	table;
+
+			return (table);
+		}
+
+		/*
+		** 8 (or 4) elements per step: compare, turn the survivors' mask into a
+		** permutation, pack them to the front and store the full register at
+		** the output. The output never passes the input, so the stray lanes
+		** land on elements already read.
+		*/
+		__attribute__((target("avx2,popcnt")))
+		inline size_t remove_equal32_avx2 (void *data, size_t n, const void *value)
+		{
+			const compress_table	&table = compress_lanes();
+			int						*p = static_cast<int*>(data);
+			int						v;
+			size_t					out = 0;
+			size_t					i = 0;
+
+			std::memcpy(&v, value, sizeof(int));
+			__m256i					needle = _mm256_set1_epi32(v);
+			for (; i + 8 <= n; i += 8)
+			{
+				__m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+				unsigned drop = (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(x, needle)));
+				unsigned keep = ~drop & 0xffu;
+				__m256i perm = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(table.lanes[keep]));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(p + out), _mm256_permutevar8x32_epi32(x, perm));
+				out += __builtin_popcount(keep);
+			}
+			if (out != i)
+				std::memmove(p + out, p + i, (n - i) * sizeof(int));
+			return (out + remove_equal_scalar<4>(p + out, n - i, value));
+		}
+
+		__attribute__((target("avx2,popcnt")))
+		inline size_t remove_equal64_avx2 (void *data, size_t n, const void *value)
+		{
+			const compress_table	&table = compress_lanes();
+			long long				*p = static_cast<long long*>(data);
+			long long				v;
+			size_t					out = 0;
+			size_t					i = 0;
+
+			std::memcpy(&v, value, sizeof(long long));
+			__m256i					needle = _mm256_set1_epi64x(v);
+			for (; i + 4 <= n; i += 4)
+			{
+				__m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+				unsigned drop = (unsigned)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(x, needle)));
+				unsigned keep = ~drop & 0xfu;
+				unsigned keep32 = 0;
+				for (int lane = 0; lane != 4; lane++)
+					if (keep & (1u << lane))
+						keep32 |= 3u << (2 * lane);
+				__m256i perm = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(table.lanes[keep32]));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(p + out), _mm256_permutevar8x32_epi32(x, perm));
+				out += __builtin_popcount(keep);
+			}
+			if (out != i)
+				std::memmove(p + out, p + i, (n - i) * sizeof(long long));
+			return (out + remove_equal_scalar<8>(p + out, n - i, value));
+		}
+#endif
+
+		template <size_t Size>
+		remove_fn select_remove_equal()
+		{
+#ifdef FT_SIMD_X86
+			__builtin_cpu_init();
+			if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt"))
+			{
+				if (Size == 4)
+					return (&remove_equal32_avx2);
+				if (Size == 8)
+					return (&remove_equal64_avx2);
+			}
+#endif
+			return (&remove_equal_scalar<Size>);
+		}
+
+		/* remove_equal_scalar<Size>, vectorized for 4- and 8-byte elements. */
+		template <size_t Size>
+		size_t remove_equal (void *data, size_t n, const void *value)
+		{
+			static const remove_fn	fn = select_remove_equal<Size>();
+
+			return (fn(data, n, value));
+		}
+	}
+}
+
+#endif
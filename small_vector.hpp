@@ -0,0 +1,589 @@
+#pragma once
+#ifndef SMALL_VECTOR_HPP
+#define SMALL_VECTOR_HPP
+
+#include <memory>
+#include <stdexcept>
+#include <cstring>
+#include "vector.hpp"
+
+namespace ft
+{
+	/*
+	** ft::vector with room for N elements inside the object itself. Nothing is
+	** allocated until the N+1th element; after that it grows on the heap like
+	** ft::vector (same vector_growth policy) and stays there.
+	*/
+	template <class T, size_t N, class Alloc = std::allocator<T> >
+	class small_vector
+	{
+	public:
+		typedef T														value_type;
+		typedef Alloc													allocator_type;
+		typedef typename allocator_type::reference						reference;
+		typedef typename allocator_type::const_reference				const_reference;
+		typedef typename allocator_type::pointer						pointer;
+		typedef typename allocator_type::const_pointer					const_pointer;
+		typedef ft::random_access_iterator<value_type>					iterator;
+		typedef ft::random_access_iterator<const value_type>			const_iterator;
+		typedef ft::reverse_iterator<iterator>							reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>					const_reverse_iterator;
+		typedef typename ft::iterator_traits<iterator>::difference_type	difference_type;
+		typedef typename allocator_type::size_type						size_type;
+
+		static const size_type	inline_capacity = N;
+	private:
+		typedef ft::vector_elements<value_type, allocator_type>	elements;
+
+		template <class, class> friend struct vector_elements;
+
+		/* Raw room for N elements, aligned for T even when T is over-aligned. */
+		struct storage
+		{
+			char	bytes[(N ? N : 1) * sizeof(T)] __attribute__((aligned(__alignof__(T))));
+		};
+
+		allocator_type	_alloc;
+		pointer			_start;
+		pointer			_end;
+		pointer			_end_capacity;
+		storage			_inline;
+
+		pointer inline_data()
+		{
+			return (reinterpret_cast<pointer>(_inline.bytes));
+		}
+
+		const_pointer inline_data() const
+		{
+			return (reinterpret_cast<const_pointer>(_inline.bytes));
+		}
+
+		void init_inline()
+		{
+			_start = inline_data();
+			_end = _start;
+			_end_capacity = _start + N;
+		}
+
+		/* Destroys the elements and gives the heap block back, if any. */
+		void release()
+		{
+			destroy_range(_start, _end);
+			if (!is_inline())
+				_alloc.deallocate(_start, capacity());
+			init_inline();
+		}
+
+		void relocate (pointer first, pointer last, pointer dest)
+		{
+			elements::relocate(_alloc, first, last, dest);
+		}
+
+		void destroy_range (pointer first, pointer last)
+		{
+			elements::destroy_range(_alloc, first, last);
+		}
+
+		template <class InputIterator>
+		void copy_construct (InputIterator first, InputIterator last, pointer dest)
+		{
+			elements::copy_construct(_alloc, first, last, dest);
+		}
+
+		void grow (size_type n)
+		{
+			elements::grow(*this, n, "error small_vector::max_size");
+		}
+
+		void swap_blocks (small_vector& x)
+		{
+			pointer tmp_start = _start;
+			pointer tmp_end = _end;
+			pointer tmp_end_capacity = _end_capacity;
+
+			_start = x._start;
+			_end = x._end;
+			_end_capacity = x._end_capacity;
+			x._start = tmp_start;
+			x._end = tmp_end;
+			x._end_capacity = tmp_end_capacity;
+		}
+
+		/*
+		** Moves the inline elements of src into the empty inline buffer of
+		** dst. Every element is built before any source is destroyed, so if
+		** one throws, src still holds all of its elements.
+		*/
+		static void move_inline (small_vector& src, small_vector& dst)
+		{
+			pointer	out = dst.inline_data();
+			pointer	it = src._start;
+
+			try
+			{
+				for (; it != src._end; it++, out++)
+					dst._alloc.construct(out, FT_MOVE(*it));
+			}
+			catch (...)
+			{
+				dst.destroy_range(dst.inline_data(), out);
+				throw ;
+			}
+			src.destroy_range(src._start, src._end);
+			dst._end = out;
+			src._end = src._start;
+		}
+	public:
+		explicit small_vector (const allocator_type& alloc = allocator_type()) : _alloc(alloc)
+		{
+			init_inline();
+		}
+
+		explicit small_vector (size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type()) :
+			_alloc(alloc)
+		{
+			init_inline();
+			insert(end(), n, val);
+		}
+
+		template <class InputIterator>
+		small_vector (InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
+					  typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL) :
+			_alloc(alloc)
+		{
+			init_inline();
+			insert(end(), first, last);
+		}
+
+		small_vector (const small_vector& x) : _alloc(x._alloc)
+		{
+			init_inline();
+			reserve(x.size());
+			copy_construct(x._start, x._end, _start);
+			_end = _start + x.size();
+		}
+
+		small_vector& operator= (const small_vector& x)
+		{
+			if (this == &x)
+				return (*this);
+			clear();
+			reserve(x.size());
+			copy_construct(x._start, x._end, _start);
+			_end = _start + x.size();
+			return (*this);
+		}
+
+#ifdef FT_CXX11
+		/* Inline elements are moved one by one, so this is noexcept only when T's move is. */
+		small_vector (small_vector&& x) noexcept(std::is_nothrow_move_constructible<T>::value) : _alloc(x._alloc)
+		{
+			init_inline();
+			steal(x);
+		}
+
+		small_vector& operator= (small_vector&& x) noexcept(std::is_nothrow_move_constructible<T>::value)
+		{
+			if (this == &x)
+				return (*this);
+			release();
+			steal(x);
+			return (*this);
+		}
+	private:
+		/* Takes x's heap block, or moves its inline elements over one by one. */
+		void steal (small_vector& x)
+		{
+			if (x.is_inline())
+			{
+				relocate(x._start, x._end, _start);
+				_end = _start + x.size();
+				x._end = x._start;
+				return ;
+			}
+			_start = x._start;
+			_end = x._end;
+			_end_capacity = x._end_capacity;
+			x.init_inline();
+		}
+	public:
+#endif
+
+		~small_vector()
+		{
+			release();
+		}
+
+		/* True while the elements still live inside the object. */
+		bool is_inline() const
+		{
+			return (_start == inline_data());
+		}
+
+		size_type capacity() const
+		{
+			return (_end_capacity - _start);
+		}
+
+		size_type size() const
+		{
+			return (_end - _start);
+		}
+
+		size_type max_size() const
+		{
+			return (allocator_type().max_size());
+		}
+
+		bool empty() const
+		{
+			return (_start == _end);
+		}
+
+		allocator_type get_allocator() const
+		{
+			return (_alloc);
+		}
+
+		iterator begin()
+		{
+			return (iterator(_start));
+		}
+
+		const_iterator begin() const
+		{
+			return (const_iterator(_start));
+		}
+
+		iterator end()
+		{
+			return (iterator(_end));
+		}
+
+		const_iterator end() const
+		{
+			return (const_iterator(_end));
+		}
+
+		reverse_iterator rbegin()
+		{
+			return (reverse_iterator(end()));
+		}
+
+		const_reverse_iterator rbegin() const
+		{
+			return (const_reverse_iterator(end()));
+		}
+
+		reverse_iterator rend()
+		{
+			return (reverse_iterator(begin()));
+		}
+
+		const_reverse_iterator rend() const
+		{
+			return (const_reverse_iterator(begin()));
+		}
+
+		void reserve (size_type n)
+		{
+			if (n > max_size())
+				throw std::length_error("error small_vector::max_size");
+			if (n <= capacity())
+				return ;
+			size_type	old_size = size();
+			pointer		new_start = _alloc.allocate(n);
+			relocate(_start, _end, new_start);
+			if (!is_inline())
+				_alloc.deallocate(_start, capacity());
+			_start = new_start;
+			_end = _start + old_size;
+			_end_capacity = _start + n;
+		}
+
+		/* Drops the unused heap capacity, moving back inline when the elements fit. */
+		void shrink_to_fit()
+		{
+			if (is_inline() || capacity() == size())
+				return ;
+			size_type	old_size = size();
+			size_type	n = (old_size <= N ? N : old_size);
+			pointer		new_start = (old_size <= N ? inline_data() : _alloc.allocate(n));
+			relocate(_start, _end, new_start);
+			_alloc.deallocate(_start, capacity());
+			_start = new_start;
+			_end = _start + old_size;
+			_end_capacity = _start + n;
+		}
+
+		void resize (size_type n, value_type val = value_type())
+		{
+			if (n < size())
+			{
+				destroy_range(_start + n, _end);
+				_end = _start + n;
+			}
+			else
+				insert(end(), n - size(), val);
+		}
+
+		reference operator[] (size_type n)
+		{
+			return (_start[n]);
+		}
+
+		const_reference operator[] (size_type n) const
+		{
+			return (_start[n]);
+		}
+
+		reference at (size_type n)
+		{
+			if (n >= size())
+				throw std::out_of_range("small_vector::at");
+			return (_start[n]);
+		}
+
+		const_reference at (size_type n) const
+		{
+			if (n >= size())
+				throw std::out_of_range("small_vector::at");
+			return (_start[n]);
+		}
+
+		reference front()
+		{
+			return (*_start);
+		}
+
+		const_reference front() const
+		{
+			return (*_start);
+		}
+
+		reference back()
+		{
+			return (*(_end - 1));
+		}
+
+		const_reference back() const
+		{
+			return (*(_end - 1));
+		}
+
+		void push_back (const value_type& val)
+		{
+			if (_end == _end_capacity)
+			{
+				value_type copy(val);
+				grow(1);
+				_alloc.construct(_end, copy);
+			}
+			else
+				_alloc.construct(_end, val);
+			_end++;
+		}
+
+#ifdef FT_CXX11
+		void push_back (value_type&& val)
+		{
+			emplace_back(std::move(val));
+		}
+
+		template <class... Args>
+		void emplace_back (Args&&... args)
+		{
+			if (_end == _end_capacity)
+			{
+				value_type tmp(std::forward<Args>(args)...);
+				grow(1);
+				_alloc.construct(_end, std::move(tmp));
+			}
+			else
+				_alloc.construct(_end, std::forward<Args>(args)...);
+			_end++;
+		}
+#endif
+
+		void pop_back()
+		{
+			_end--;
+			_alloc.destroy(_end);
+		}
+
+		iterator insert (iterator position, const value_type& val)
+		{
+			difference_type ret = position.base() - _start;
+			value_type		copy(val);
+			grow(1);
+			pointer pos = _start + ret;
+			relocate(pos, _end, pos + 1);
+			_alloc.construct(pos, copy);
+			_end++;
+			return (iterator(pos));
+		}
+
+		void insert (iterator position, size_type n, const value_type& val)
+		{
+			if (n == 0)
+				return ;
+			difference_type ret = position.base() - _start;
+			value_type		copy(val);
+			grow(n);
+			pointer pos = _start + ret;
+			relocate(pos, _end, pos + n);
+			for (size_type i = 0; i != n; i++)
+				_alloc.construct(pos + i, copy);
+			_end += n;
+		}
+
+		template <class InputIterator>
+		void insert (iterator position, InputIterator first, InputIterator last,
+					 typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL)
+		{
+			elements::range_insert(*this, position, first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+		}
+
+		iterator erase (iterator position)
+		{
+			pointer pos = position.base();
+			_alloc.destroy(pos);
+			relocate(pos + 1, _end, pos);
+			_end--;
+			return (position);
+		}
+
+		iterator erase (iterator first, iterator last)
+		{
+			pointer left = first.base();
+			pointer right = last.base();
+
+			destroy_range(left, right);
+			relocate(right, _end, left);
+			_end -= right - left;
+			return (first);
+		}
+
+		template <class InputIterator>
+		void assign (InputIterator first, InputIterator last,
+					 typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL)
+		{
+			clear();
+			insert(end(), first, last);
+		}
+
+		void assign (size_type n, const value_type& val)
+		{
+			clear();
+			insert(end(), n, val);
+		}
+
+		void clear()
+		{
+			destroy_range(_start, _end);
+			_end = _start;
+		}
+
+		/*
+		** Exchanges heap blocks when both sides have one; inline elements are
+		** swapped or moved one by one, so no element is copied and nothing is
+		** allocated.
+		*/
+		void swap (small_vector& x)
+		{
+			if (this == &x)
+				return ;
+			if (!is_inline() && !x.is_inline())
+			{
+				swap_blocks(x);
+				return ;
+			}
+			if (is_inline() && x.is_inline())
+			{
+				small_vector	&longer = (size() < x.size() ? x : *this);
+				small_vector	&shorter = (size() < x.size() ? *this : x);
+				size_type		common = shorter.size();
+
+				for (size_type i = 0; i != common; i++)
+				{
+					value_type tmp(FT_MOVE(_start[i]));
+					_start[i] = FT_MOVE(x._start[i]);
+					x._start[i] = FT_MOVE(tmp);
+				}
+				for (pointer it = longer._start + common; it != longer._end; it++, shorter._end++)
+					_alloc.construct(shorter._end, FT_MOVE(*it));
+				longer.destroy_range(longer._start + common, longer._end);
+				longer._end = longer._start + common;
+				return ;
+			}
+			small_vector	&heap = (is_inline() ? x : *this);
+			small_vector	&local = (is_inline() ? *this : x);
+			pointer			start = heap._start;
+			pointer			end = heap._end;
+			pointer			end_capacity = heap._end_capacity;
+
+			heap.init_inline();
+			try
+			{
+				move_inline(local, heap);
+			}
+			catch (...)
+			{
+				heap._start = start;
+				heap._end = end;
+				heap._end_capacity = end_capacity;
+				throw ;
+			}
+			local._start = start;
+			local._end = end;
+			local._end_capacity = end_capacity;
+		}
+	};
+
+	template <class T, size_t N, class Alloc>
+	void swap (small_vector<T,N,Alloc>& x, small_vector<T,N,Alloc>& y)
+	{
+		x.swap(y);
+	}
+
+	template <class T, size_t N, class Alloc>
+	bool operator== (const small_vector<T,N,Alloc>& lhs, const small_vector<T,N,Alloc>& rhs)
+	{
+		if (lhs.size() != rhs.size())
+			return (false);
+		return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <class T, size_t N, class Alloc>
+	bool operator!= (const small_vector<T,N,Alloc>& lhs, const small_vector<T,N,Alloc>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template <class T, size_t N, class Alloc>
+	bool operator< (const small_vector<T,N,Alloc>& lhs, const small_vector<T,N,Alloc>& rhs)
+	{
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template <class T, size_t N, class Alloc>
+	bool operator<= (const small_vector<T,N,Alloc>& lhs, const small_vector<T,N,Alloc>& rhs)
+	{
+		return (!(rhs < lhs));
+	}
+
+	template <class T, size_t N, class Alloc>
+	bool operator> (const small_vector<T,N,Alloc>& lhs, const small_vector<T,N,Alloc>& rhs)
+	{
+		return (rhs < lhs);
+	}
+
+	template <class T, size_t N, class Alloc>
+	bool operator>= (const small_vector<T,N,Alloc>& lhs, const small_vector<T,N,Alloc>& rhs)
+	{
+		return (!(lhs < rhs));
+	}
+}
+
+#endif
@@ -0,0 +1,547 @@
+#pragma once
+#ifndef SOA_VECTOR_HPP
+#define SOA_VECTOR_HPP
+
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include "utils.hpp"
+#include "vector.hpp"
+
+namespace ft
+{
+	/* Placeholder for the unused columns of an ft::soa_vector; stores nothing. */
+	struct soa_none {};
+
+	template <size_t I>
+	struct soa_index {};
+
+	template <size_t I, class T0, class T1, class T2, class T3>
+	struct soa_type_at;
+
+	template <class T0, class T1, class T2, class T3>
+	struct soa_type_at<0, T0, T1, T2, T3> { typedef T0 type; };
+
+	template <class T0, class T1, class T2, class T3>
+	struct soa_type_at<1, T0, T1, T2, T3> { typedef T1 type; };
+
+	template <class T0, class T1, class T2, class T3>
+	struct soa_type_at<2, T0, T1, T2, T3> { typedef T2 type; };
+
+	template <class T0, class T1, class T2, class T3>
+	struct soa_type_at<3, T0, T1, T2, T3> { typedef T3 type; };
+
+	/* One column of an ft::soa_vector: a plain array, ready for vectorized loops. */
+	template <class T>
+	class soa_span
+	{
+	public:
+		typedef T		value_type;
+		typedef T*		iterator;
+		typedef size_t	size_type;
+	private:
+		T			*_data;
+		size_type	_size;
+	public:
+		soa_span() : _data(NULL), _size(0) {}
+		soa_span(T *data, size_type size) : _data(data), _size(size) {}
+
+		T *data() const
+		{
+			return (_data);
+		}
+
+		size_type size() const
+		{
+			return (_size);
+		}
+
+		bool empty() const
+		{
+			return (_size == 0);
+		}
+
+		iterator begin() const
+		{
+			return (_data);
+		}
+
+		iterator end() const
+		{
+			return (_data + _size);
+		}
+
+		T& operator[] (size_type n) const
+		{
+			return (_data[n]);
+		}
+	};
+
+	/* A row of an ft::soa_vector held by value. */
+	template <class T0, class T1 = soa_none, class T2 = soa_none, class T3 = soa_none>
+	struct soa_row
+	{
+		T0	f0;
+		T1	f1;
+		T2	f2;
+		T3	f3;
+
+		soa_row() : f0(), f1(), f2(), f3() {}
+		soa_row(const T0& a, const T1& b = T1(), const T2& c = T2(), const T3& d = T3()) : f0(a), f1(b), f2(c), f3(d) {}
+
+		T0& get(soa_index<0>) { return (f0); }
+		T1& get(soa_index<1>) { return (f1); }
+		T2& get(soa_index<2>) { return (f2); }
+		T3& get(soa_index<3>) { return (f3); }
+		const T0& get(soa_index<0>) const { return (f0); }
+		const T1& get(soa_index<1>) const { return (f1); }
+		const T2& get(soa_index<2>) const { return (f2); }
+		const T3& get(soa_index<3>) const { return (f3); }
+
+		template <size_t I>
+		typename soa_type_at<I, T0, T1, T2, T3>::type& get()
+		{
+			return (get(soa_index<I>()));
+		}
+
+		template <size_t I>
+		const typename soa_type_at<I, T0, T1, T2, T3>::type& get() const
+		{
+			return (get(soa_index<I>()));
+		}
+	};
+
+	/*
+	** Structure of arrays: up to four fields per row, each kept in its own
+	** contiguous column, all sharing one size and capacity. Scanning one
+	** field touches only that field's bytes, and column<I>() hands the
+	** column out as a plain array. operator[] returns a row proxy whose
+	** get<I>() reaches into the columns, for code written against rows.
+	** Unused trailing fields default to soa_none and cost nothing.
+	*/
+	template <class T0, class T1 = soa_none, class T2 = soa_none, class T3 = soa_none, class Alloc = std::allocator<T0> >
+	class soa_vector
+	{
+	public:
+		typedef soa_row<T0, T1, T2, T3>		value_type;
+		typedef Alloc						allocator_type;
+		typedef size_t						size_type;
+
+		template <size_t I>
+		struct field
+		{
+			typedef typename soa_type_at<I, T0, T1, T2, T3>::type	type;
+		};
+
+		/* Proxy for row i; assigning to it writes every column. */
+		class reference
+		{
+			friend class soa_vector;
+
+			soa_vector	*_v;
+			size_type	_i;
+
+			reference(soa_vector *v, size_type i) : _v(v), _i(i) {}
+		public:
+			/* An unused column has no array; its get() hands out a shared empty soa_none. */
+			template <size_t I>
+			typename field<I>::type& get() const
+			{
+				return (element_or_none(_v->data(soa_index<I>()), _i));
+			}
+
+			operator value_type() const
+			{
+				return (value_type(get<0>(), get<1>(), get<2>(), get<3>()));
+			}
+
+			reference& operator= (const value_type& row)
+			{
+				get<0>() = row.f0;
+				get<1>() = row.f1;
+				get<2>() = row.f2;
+				get<3>() = row.f3;
+				return (*this);
+			}
+
+			reference& operator= (const reference& x)
+			{
+				return (*this = value_type(x));
+			}
+		};
+	private:
+		allocator_type	_alloc;
+		size_type		_size;
+		size_type		_capacity;
+		T0				*_c0;
+		T1				*_c1;
+		T2				*_c2;
+		T3				*_c3;
+
+		template <class T>
+		T *allocate_column (T*, size_type n)
+		{
+			typename allocator_type::template rebind<T>::other a(_alloc);
+			return (a.allocate(n));
+		}
+
+		soa_none *allocate_column (soa_none*, size_type)
+		{
+			return (NULL);
+		}
+
+		template <class T>
+		void deallocate_column (T *col, size_type n)
+		{
+			typename allocator_type::template rebind<T>::other a(_alloc);
+			if (col != NULL)
+				a.deallocate(col, n);
+		}
+
+		void deallocate_column (soa_none*, size_type) {}
+
+		template <class T>
+		void relocate_column (T *from, T *to, size_type n)
+		{
+			relocate_column(from, to, n, ft::is_integral_res<bool, ft::is_trivially_relocatable<T>::value>());
+		}
+
+		template <class T>
+		void relocate_column (T *from, T *to, size_type n, ft::true_type)
+		{
+			if (n != 0)
+				std::memcpy(static_cast<void*>(to), static_cast<const void*>(from), n * sizeof(T));
+		}
+
+		template <class T>
+		void relocate_column (T *from, T *to, size_type n, ft::false_type)
+		{
+			typename allocator_type::template rebind<T>::other a(_alloc);
+			for (size_type i = 0; i != n; i++)
+			{
+				a.construct(to + i, FT_MOVE_IF_NOEXCEPT(from[i]));
+				a.destroy(from + i);
+			}
+		}
+
+		void relocate_column (soa_none*, soa_none*, size_type) {}
+
+		template <class T>
+		void construct_at (T *col, const T& val)
+		{
+			typename allocator_type::template rebind<T>::other a(_alloc);
+			a.construct(col + _size, val);
+		}
+
+		void construct_at (soa_none*, const soa_none&) {}
+
+		template <class T>
+		void destroy_column (T *col, size_type first, size_type last)
+		{
+			destroy_column(col, first, last, ft::is_integral_res<bool, ft::is_trivially_copyable<T>::value>());
+		}
+
+		template <class T>
+		void destroy_column (T*, size_type, size_type, ft::true_type) {}
+
+		template <class T>
+		void destroy_column (T *col, size_type first, size_type last, ft::false_type)
+		{
+			typename allocator_type::template rebind<T>::other a(_alloc);
+			for (; first != last; first++)
+				a.destroy(col + first);
+		}
+
+		void destroy_column (soa_none*, size_type, size_type) {}
+
+		/* Moves every column to a block of n rows; nothing changes if an allocation fails. */
+		void reallocate (size_type n)
+		{
+			T0	*c0 = allocate_column(_c0, n);
+			T1	*c1 = NULL;
+			T2	*c2 = NULL;
+			T3	*c3 = NULL;
+
+			try
+			{
+				c1 = allocate_column(_c1, n);
+				c2 = allocate_column(_c2, n);
+				c3 = allocate_column(_c3, n);
+			}
+			catch (...)
+			{
+				deallocate_column(c0, n);
+				deallocate_column(c1, n);
+				deallocate_column(c2, n);
+				throw ;
+			}
+			relocate_column(_c0, c0, _size);
+			relocate_column(_c1, c1, _size);
+			relocate_column(_c2, c2, _size);
+			relocate_column(_c3, c3, _size);
+			release();
+			_c0 = c0;
+			_c1 = c1;
+			_c2 = c2;
+			_c3 = c3;
+			_capacity = n;
+		}
+
+		/* Frees the columns without touching the elements. */
+		void release()
+		{
+			deallocate_column(_c0, _capacity);
+			deallocate_column(_c1, _capacity);
+			deallocate_column(_c2, _capacity);
+			deallocate_column(_c3, _capacity);
+			_c0 = NULL;
+			_c1 = NULL;
+			_c2 = NULL;
+			_c3 = NULL;
+			_capacity = 0;
+		}
+
+		void destroy_rows (size_type first, size_type last)
+		{
+			destroy_column(_c0, first, last);
+			destroy_column(_c1, first, last);
+			destroy_column(_c2, first, last);
+			destroy_column(_c3, first, last);
+		}
+
+		T0 *data (soa_index<0>) const { return (_c0); }
+		T1 *data (soa_index<1>) const { return (_c1); }
+		T2 *data (soa_index<2>) const { return (_c2); }
+		T3 *data (soa_index<3>) const { return (_c3); }
+	public:
+		explicit soa_vector (const allocator_type& alloc = allocator_type()) :
+			_alloc(alloc), _size(0), _capacity(0), _c0(NULL), _c1(NULL), _c2(NULL), _c3(NULL) {}
+
+		soa_vector (const soa_vector& x) :
+			_alloc(x._alloc), _size(0), _capacity(0), _c0(NULL), _c1(NULL), _c2(NULL), _c3(NULL)
+		{
+			reserve(x._size);
+			for (size_type i = 0; i != x._size; i++)
+				push_back(x[i]);
+		}
+
+		soa_vector& operator= (const soa_vector& x)
+		{
+			if (this == &x)
+				return (*this);
+			clear();
+			reserve(x._size);
+			for (size_type i = 0; i != x._size; i++)
+				push_back(x[i]);
+			return (*this);
+		}
+
+#ifdef FT_CXX11
+		soa_vector (soa_vector&& x) noexcept :
+			_alloc(x._alloc), _size(0), _capacity(0), _c0(NULL), _c1(NULL), _c2(NULL), _c3(NULL)
+		{
+			swap(x);
+		}
+
+		soa_vector& operator= (soa_vector&& x) noexcept
+		{
+			if (this != &x)
+			{
+				clear();
+				release();
+				swap(x);
+			}
+			return (*this);
+		}
+#endif
+
+		~soa_vector()
+		{
+			clear();
+			release();
+		}
+
+		size_type size() const
+		{
+			return (_size);
+		}
+
+		size_type capacity() const
+		{
+			return (_capacity);
+		}
+
+		bool empty() const
+		{
+			return (_size == 0);
+		}
+
+		void reserve (size_type n)
+		{
+			if (n > _capacity)
+				reallocate(n);
+		}
+
+		void shrink_to_fit()
+		{
+			if (_size == 0)
+				release();
+			else if (_size != _capacity)
+				reallocate(_size);
+		}
+
+		/* Column I as a plain array of size() elements. */
+		template <size_t I>
+		soa_span<typename field<I>::type> column()
+		{
+			return (soa_span<typename field<I>::type>(data(soa_index<I>()), _size));
+		}
+
+		template <size_t I>
+		soa_span<const typename field<I>::type> column() const
+		{
+			return (soa_span<const typename field<I>::type>(data(soa_index<I>()), _size));
+		}
+
+		reference operator[] (size_type n)
+		{
+			return (reference(this, n));
+		}
+
+		value_type operator[] (size_type n) const
+		{
+			return (value_type(_c0[n], get_or_none(_c1, n), get_or_none(_c2, n), get_or_none(_c3, n)));
+		}
+
+		reference at (size_type n)
+		{
+			if (n >= _size)
+				throw std::out_of_range("soa_vector::at");
+			return ((*this)[n]);
+		}
+
+		value_type at (size_type n) const
+		{
+			if (n >= _size)
+				throw std::out_of_range("soa_vector::at");
+			return ((*this)[n]);
+		}
+
+		reference back()
+		{
+			return (reference(this, _size - 1));
+		}
+
+		void push_back (const T0& a, const T1& b = T1(), const T2& c = T2(), const T3& d = T3())
+		{
+			if (_size == _capacity)
+			{
+				if (_size == max_size())
+					throw std::length_error("error soa_vector::max_size");
+				/* the arguments may live in the columns about to move */
+				value_type row(a, b, c, d);
+				reallocate(ft::vector_growth<value_type>::next_capacity(_size, _size + 1));
+				push_row(row);
+				return ;
+			}
+			construct_at(_c0, a);
+			construct_at(_c1, b);
+			construct_at(_c2, c);
+			construct_at(_c3, d);
+			_size++;
+		}
+
+		void push_back (const value_type& row)
+		{
+			push_back(row.f0, row.f1, row.f2, row.f3);
+		}
+
+		void pop_back()
+		{
+			destroy_rows(_size - 1, _size);
+			_size--;
+		}
+
+		void resize (size_type n, const value_type& row = value_type())
+		{
+			if (n < _size)
+			{
+				destroy_rows(n, _size);
+				_size = n;
+				return ;
+			}
+			reserve(n);
+			while (_size != n)
+				push_row(row);
+		}
+
+		void clear()
+		{
+			destroy_rows(0, _size);
+			_size = 0;
+		}
+
+		size_type max_size() const
+		{
+			return (_alloc.max_size());
+		}
+
+		void swap (soa_vector& x)
+		{
+			std::swap(_alloc, x._alloc);
+			std::swap(_size, x._size);
+			std::swap(_capacity, x._capacity);
+			std::swap(_c0, x._c0);
+			std::swap(_c1, x._c1);
+			std::swap(_c2, x._c2);
+			std::swap(_c3, x._c3);
+		}
+
+		allocator_type get_allocator() const
+		{
+			return (_alloc);
+		}
+	private:
+		/* Appends a row known not to alias the columns, capacity permitting. */
+		void push_row (const value_type& row)
+		{
+			construct_at(_c0, row.f0);
+			construct_at(_c1, row.f1);
+			construct_at(_c2, row.f2);
+			construct_at(_c3, row.f3);
+			_size++;
+		}
+
+		template <class T>
+		static const T& get_or_none (const T *col, size_type n)
+		{
+			return (col[n]);
+		}
+
+		static soa_none get_or_none (const soa_none*, size_type)
+		{
+			return (soa_none());
+		}
+
+		template <class T>
+		static T& element_or_none (T *col, size_type n)
+		{
+			return (col[n]);
+		}
+
+		static soa_none& element_or_none (soa_none*, size_type)
+		{
+			static soa_none	none;
+
+			return (none);
+		}
+	};
+
+	template <class T0, class T1, class T2, class T3, class Alloc>
+	void swap (soa_vector<T0, T1, T2, T3, Alloc>& x, soa_vector<T0, T1, T2, T3, Alloc>& y)
+	{
+		x.swap(y);
+	}
+}
+
+#endif
@@ -0,0 +1,721 @@
+#pragma once
+#ifndef SPLIT_MAP_HPP
+#define SPLIT_MAP_HPP
+
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include "iterator.hpp"
+#include "utils.hpp"
+#include "vector.hpp"
+
+namespace ft
+{
+	/*
+	** Hot part of a split_map node: the key and the links only. The mapped
+	** value lives in the map's value store at _index, so a search never pulls
+	** the payload into cache.
+	*/
+	template <class Key>
+	struct key_tree
+	{
+	public:
+		Key			_key;
+		size_t		_index;
+		key_tree	*_left_node;
+		key_tree	*_right_node;
+		key_tree	*_parent_node;
+
+		key_tree(const Key &key, size_t index, key_tree *parent = NULL) :
+				_key(key), _index(index), _left_node(NULL), _right_node(NULL), _parent_node(parent) {}
+	};
+
+	template <class T, class T2, class Store>
+	class split_map_iterator : public iterator<std::bidirectional_iterator_tag, T>
+	{
+	public:
+		typedef typename iterator<std::bidirectional_iterator_tag, T>::value_type			value_type;
+		typedef typename iterator<std::bidirectional_iterator_tag, T>::difference_type		difference_type;
+		typedef typename iterator<std::bidirectional_iterator_tag, T>::iterator_category	iterator_category;
+		typedef T*																			pointer;
+		typedef T&																			reference;
+	private:
+		T2		*node;
+		T2		*last;
+		Store	*store;
+	public:
+		split_map_iterator(void) : node(NULL), last(NULL), store(NULL) {}
+		split_map_iterator(T2 *_node, T2 *_last, Store *_store) : node(_node), last(_last), store(_store) {}
+
+		split_map_iterator &operator++(void)
+		{
+			if (node == NULL)
+				return (*this);
+			if (node->_right_node != NULL)
+			{
+				node = node->_right_node;
+				while (node->_left_node != NULL)
+					node = node->_left_node;
+				return (*this);
+			}
+			T2 *prev = node;
+			while (node->_parent_node != NULL && node->_parent_node->_right_node == node)
+				node = node->_parent_node;
+			node = node->_parent_node;
+			if (node == NULL)
+				last = prev;
+			return (*this);
+		}
+
+		split_map_iterator operator++(int)
+		{
+			split_map_iterator tmp(*this);
+			this->operator++();
+			return (tmp);
+		}
+
+		split_map_iterator &operator--(void)
+		{
+			if (node == NULL)
+			{
+				node = last;
+				return (*this);
+			}
+			if (node->_left_node != NULL)
+			{
+				node = node->_left_node;
+				while (node->_right_node != NULL)
+					node = node->_right_node;
+				return (*this);
+			}
+			while (node->_parent_node != NULL && node->_parent_node->_left_node == node)
+				node = node->_parent_node;
+			node = node->_parent_node;
+			return (*this);
+		}
+
+		split_map_iterator operator--(int)
+		{
+			split_map_iterator tmp(*this);
+			this->operator--();
+			return (tmp);
+		}
+
+		bool operator==(const split_map_iterator& it) const
+		{
+			return (this->node == it.node);
+		}
+
+		bool operator!=(const split_map_iterator& it) const
+		{
+			return (!(*this == it));
+		}
+
+		T2 *base() const
+		{
+			return (node);
+		}
+
+		reference operator*() const
+		{
+			return ((*store)[node->_index]);
+		}
+
+		pointer operator->() const
+		{
+			return (&((*store)[node->_index]));
+		}
+
+		operator ft::split_map_iterator<const T, const T2, const Store>() const
+		{
+			return ft::split_map_iterator<const T, const T2, const Store>(node, last, store);
+		}
+	};
+
+	/*
+	** Ordered map with a hot/cold split layout: tree nodes hold keys and
+	** links, values are packed in one contiguous ft::vector. Inserting may
+	** reallocate the value store, so it invalidates references to values.
+	*/
+	template < class Key, class T, class Compare = ft::less<Key>, class Alloc = std::allocator<ft::pair<const Key,T> > >
+	class split_map
+	{
+	public:
+		typedef Key																		key_type;
+		typedef T																		mapped_type;
+		typedef ft::pair<const key_type, mapped_type>									value_type;
+		typedef Compare																	key_compare;
+		typedef	Alloc																	allocator_type;
+		typedef typename allocator_type::reference										reference;
+		typedef typename allocator_type::const_reference								const_reference;
+		typedef typename allocator_type::pointer										pointer;
+		typedef typename allocator_type::const_pointer									const_pointer;
+		typedef ft::vector<value_type, allocator_type>									store_type;
+		typedef ft::split_map_iterator<value_type, ft::key_tree<key_type>, store_type>	iterator;
+		typedef ft::split_map_iterator<const value_type, const ft::key_tree<key_type>,
+									   const store_type>								const_iterator;
+		typedef ft::reverse_iterator<iterator>											reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>									const_reverse_iterator;
+		typedef typename ft::iterator_traits<iterator>::difference_type					difference_type;
+		typedef typename allocator_type::size_type										size_type;
+	private:
+		typedef key_tree<key_type>										k_tree;
+		typedef typename allocator_type::template rebind<k_tree>::other	tree_allocator_type;
+		key_compare									_comp;
+		tree_allocator_type							_alloc_tree;
+		k_tree										*_root;
+		store_type									_store;
+
+		k_tree *findnode (const key_type& k) const
+		{
+			k_tree	*tmp = _root;
+
+			while (tmp != NULL)
+			{
+				if (_comp(k, tmp->_key))
+					tmp = tmp->_left_node;
+				else if (_comp(tmp->_key, k))
+					tmp = tmp->_right_node;
+				else
+					return (tmp);
+			}
+			return (NULL);
+		}
+
+		k_tree *min_node (k_tree *tmp) const
+		{
+			if (tmp != NULL)
+				while (tmp->_left_node != NULL)
+					tmp = tmp->_left_node;
+			return (tmp);
+		}
+
+		k_tree *max_node (k_tree *tmp) const
+		{
+			if (tmp != NULL)
+				while (tmp->_right_node != NULL)
+					tmp = tmp->_right_node;
+			return (tmp);
+		}
+
+		k_tree *prev_node (k_tree *node) const
+		{
+			if (node->_left_node != NULL)
+				return (max_node(node->_left_node));
+			while (node->_parent_node != NULL && node->_parent_node->_left_node == node)
+				node = node->_parent_node;
+			return (node->_parent_node);
+		}
+
+		/* First node whose key is not below k, or above k when upper is set. */
+		k_tree *bound (const key_type& k, bool upper) const
+		{
+			k_tree	*tmp = _root;
+			k_tree	*res = NULL;
+
+			while (tmp != NULL)
+			{
+				if (upper ? !_comp(k, tmp->_key) : _comp(tmp->_key, k))
+					tmp = tmp->_right_node;
+				else
+				{
+					res = tmp;
+					tmp = tmp->_left_node;
+				}
+			}
+			return (res);
+		}
+
+		/* Where k belongs under _root; NULL, with parent on the match, when k is already there. */
+		k_tree **find_link (const key_type& k, k_tree *&parent) const
+		{
+			k_tree	**link = const_cast<k_tree **>(&_root);
+
+			parent = NULL;
+			while (*link != NULL)
+			{
+				parent = *link;
+				if (_comp(k, parent->_key))
+					link = &parent->_left_node;
+				else if (_comp(parent->_key, k))
+					link = &parent->_right_node;
+				else
+					return (NULL);
+			}
+			return (link);
+		}
+
+		/* A node for the value that the next push onto _store will hold. */
+		k_tree *new_node (k_tree *parent, const key_type& k)
+		{
+			k_tree *node = _alloc_tree.allocate(1);
+			try
+			{
+				_alloc_tree.construct(node, k_tree(k, _store.size(), parent));
+			}
+			catch (...)
+			{
+				_alloc_tree.deallocate(node, 1);
+				throw ;
+			}
+			return (node);
+		}
+
+		void drop_node (k_tree *node)
+		{
+			_alloc_tree.destroy(node);
+			_alloc_tree.deallocate(node, 1);
+		}
+
+		/*
+		** Hangs a node for val at *link. The node is built before the value is
+		** stored and dropped again if storing throws, so a failed insert leaves
+		** neither an orphan value nor a dangling node.
+		*/
+		k_tree *attach (k_tree *parent, k_tree **link, const value_type& val)
+		{
+			k_tree *node = new_node(parent, val.first);
+			try
+			{
+				_store.push_back(val);
+			}
+			catch (...)
+			{
+				drop_node(node);
+				throw ;
+			}
+			*link = node;
+			return (node);
+		}
+
+#ifdef FT_CXX11
+		k_tree *attach (k_tree *parent, k_tree **link, value_type&& val)
+		{
+			k_tree *node = new_node(parent, val.first);
+			try
+			{
+				_store.push_back(std::move(val));
+			}
+			catch (...)
+			{
+				drop_node(node);
+				throw ;
+			}
+			*link = node;
+			return (node);
+		}
+#endif
+
+		void transplant (k_tree *old_node, k_tree *new_node)
+		{
+			if (old_node->_parent_node == NULL)
+				_root = new_node;
+			else if (old_node->_parent_node->_left_node == old_node)
+				old_node->_parent_node->_left_node = new_node;
+			else
+				old_node->_parent_node->_right_node = new_node;
+			if (new_node != NULL)
+				new_node->_parent_node = old_node->_parent_node;
+		}
+
+		/* Frees a subtree leaf by leaf through the parent links, without recursing. */
+		void destroy_tree (k_tree *node)
+		{
+			k_tree *stop = (node == NULL ? NULL : node->_parent_node);
+
+			while (node != stop)
+			{
+				if (node->_left_node != NULL)
+					node = node->_left_node;
+				else if (node->_right_node != NULL)
+					node = node->_right_node;
+				else
+				{
+					k_tree *parent = node->_parent_node;
+					if (parent != NULL && parent->_left_node == node)
+						parent->_left_node = NULL;
+					else if (parent != NULL)
+						parent->_right_node = NULL;
+					_alloc_tree.destroy(node);
+					_alloc_tree.deallocate(node, 1);
+					node = parent;
+				}
+			}
+		}
+
+		/*
+		** Moves the last stored value into the slot at `index` and drops the
+		** last slot. The key is only const to users, and neither slot is
+		** reachable by them while this runs, so it is assigned in place. If a
+		** move throws, both slots stay alive and the store keeps its size.
+		*/
+		void remove_value (size_t index)
+		{
+			size_t last = _store.size() - 1;
+			if (index != last)
+			{
+				k_tree		*moved = findnode(_store[last].first);
+				value_type	&hole = _store[index];
+				value_type	&tail = _store[last];
+				hole.second = FT_MOVE(tail.second);
+				const_cast<key_type&>(hole.first) = FT_MOVE(const_cast<key_type&>(tail.first));
+				_store.pop_back();
+				moved->_index = index;
+				return ;
+			}
+			_store.pop_back();
+		}
+	public:
+		explicit split_map (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) :
+			_comp(comp), _alloc_tree(alloc), _root(NULL), _store(alloc) {}
+
+		template <class InputIterator>
+		split_map (InputIterator first, InputIterator last,
+				   const key_compare& comp = key_compare(),
+				   const allocator_type& alloc = allocator_type()) : _comp(comp), _alloc_tree(alloc), _root(NULL), _store(alloc)
+		{
+			insert(first, last);
+		}
+
+		split_map (const split_map& x) : _comp(x._comp), _alloc_tree(x._alloc_tree), _root(NULL), _store(x._store.get_allocator())
+		{
+			insert(x.begin(), x.end());
+		}
+
+		split_map& operator=(const split_map& x)
+		{
+			if (this == &x)
+				return (*this);
+			clear();
+			_comp = x._comp;
+			insert(x.begin(), x.end());
+			return (*this);
+		}
+
+#ifdef FT_CXX11
+		split_map (split_map&& x) noexcept : _comp(x._comp), _alloc_tree(x._alloc_tree), _root(NULL), _store(x._store.get_allocator())
+		{
+			swap(x);
+		}
+
+		split_map& operator=(split_map&& x) noexcept
+		{
+			if (this == &x)
+				return (*this);
+			clear();
+			swap(x);
+			return (*this);
+		}
+#endif
+
+		~split_map()
+		{
+			destroy_tree(_root);
+		}
+
+		iterator					begin()
+		{
+			return (iterator(min_node(_root), max_node(_root), &_store));
+		}
+
+		const_iterator				begin() const
+		{
+			return (const_iterator(min_node(_root), max_node(_root), &_store));
+		}
+
+		iterator					end()
+		{
+			return (iterator(NULL, max_node(_root), &_store));
+		}
+
+		const_iterator				end() const
+		{
+			return (const_iterator(NULL, max_node(_root), &_store));
+		}
+
+		reverse_iterator			rbegin()
+		{
+			return (reverse_iterator(end()));
+		}
+
+		const_reverse_iterator		rbegin() const
+		{
+			return (const_reverse_iterator(end()));
+		}
+
+		reverse_iterator			rend()
+		{
+			return (reverse_iterator(begin()));
+		}
+
+		const_reverse_iterator		rend() const
+		{
+			return (const_reverse_iterator(begin()));
+		}
+
+		bool						empty() const
+		{
+			return (_store.empty());
+		}
+
+		size_type					size() const
+		{
+			return (_store.size());
+		}
+
+		size_type					max_size() const
+		{
+			return (_alloc_tree.max_size());
+		}
+
+		key_compare					key_comp() const
+		{
+			return (_comp);
+		}
+
+		/* The values in storage order, for scans that do not need key order. */
+		const store_type&			values() const
+		{
+			return (_store);
+		}
+
+		iterator					find(const key_type& k)
+		{
+			k_tree *res = findnode(k);
+			if (res == NULL)
+				return (end());
+			return (iterator(res, NULL, &_store));
+		}
+
+		const_iterator				find(const key_type& k) const
+		{
+			k_tree *res = findnode(k);
+			if (res == NULL)
+				return (end());
+			return (const_iterator(res, NULL, &_store));
+		}
+
+		size_type					count(const key_type& k) const
+		{
+			return (findnode(k) != NULL);
+		}
+
+		iterator					lower_bound(const key_type& k)
+		{
+			k_tree *res = bound(k, false);
+			if (res == NULL)
+				return (end());
+			return (iterator(res, NULL, &_store));
+		}
+
+		const_iterator				lower_bound(const key_type& k) const
+		{
+			k_tree *res = bound(k, false);
+			if (res == NULL)
+				return (end());
+			return (const_iterator(res, NULL, &_store));
+		}
+
+		iterator					upper_bound(const key_type& k)
+		{
+			k_tree *res = bound(k, true);
+			if (res == NULL)
+				return (end());
+			return (iterator(res, NULL, &_store));
+		}
+
+		const_iterator				upper_bound(const key_type& k) const
+		{
+			k_tree *res = bound(k, true);
+			if (res == NULL)
+				return (end());
+			return (const_iterator(res, NULL, &_store));
+		}
+
+		ft::pair<iterator, iterator>				equal_range(const key_type& k)
+		{
+			return (ft::make_pair(lower_bound(k), upper_bound(k)));
+		}
+
+		ft::pair<const_iterator, const_iterator>	equal_range(const key_type& k) const
+		{
+			return (ft::make_pair(lower_bound(k), upper_bound(k)));
+		}
+
+		ft::pair<iterator,bool>		insert(const value_type& val)
+		{
+			k_tree	*parent;
+			k_tree	**link = find_link(val.first, parent);
+
+			if (link == NULL)
+				return (ft::make_pair(iterator(parent, NULL, &_store), false));
+			return (ft::make_pair(iterator(attach(parent, link, val), NULL, &_store), true));
+		}
+
+#ifdef FT_CXX11
+		ft::pair<iterator,bool>		insert(value_type&& val)
+		{
+			return (emplace(std::move(val)));
+		}
+
+		/* Builds the entry from args once and moves it into the value store. */
+		template <class... Args>
+		ft::pair<iterator,bool>		emplace(Args&&... args)
+		{
+			value_type	val(std::forward<Args>(args)...);
+			k_tree		*parent;
+			k_tree		**link = find_link(val.first, parent);
+
+			if (link == NULL)
+				return (ft::make_pair(iterator(parent, NULL, &_store), false));
+			return (ft::make_pair(iterator(attach(parent, link, std::move(val)), NULL, &_store), true));
+		}
+#endif
+
+		/* Links val next to position in O(1) when it sorts right before it. */
+		iterator					insert(iterator position, const value_type& val)
+		{
+			k_tree	*hint = position.base();
+			k_tree	*prev = (hint == NULL ? max_node(_root) : prev_node(hint));
+
+			if ((hint == NULL && prev == NULL) || (hint != NULL && !_comp(val.first, hint->_key))
+				|| (prev != NULL && !_comp(prev->_key, val.first)))
+				return (insert(val).first);
+			if (hint != NULL && hint->_left_node == NULL)
+				return (iterator(attach(hint, &hint->_left_node, val), NULL, &_store));
+			return (iterator(attach(prev, &prev->_right_node, val), NULL, &_store));
+		}
+
+		template <class InputIterator>
+		void						insert(InputIterator first, InputIterator last)
+		{
+			while (first != last)
+			{
+				insert(*first);
+				first++;
+			}
+		}
+
+		void						erase(iterator position)
+		{
+			k_tree	*node = position.base();
+
+			remove_value(node->_index);
+			if (node->_left_node == NULL)
+				transplant(node, node->_right_node);
+			else if (node->_right_node == NULL)
+				transplant(node, node->_left_node);
+			else
+			{
+				k_tree *next = min_node(node->_right_node);
+				if (next->_parent_node != node)
+				{
+					transplant(next, next->_right_node);
+					next->_right_node = node->_right_node;
+					next->_right_node->_parent_node = next;
+				}
+				transplant(node, next);
+				next->_left_node = node->_left_node;
+				next->_left_node->_parent_node = next;
+			}
+			_alloc_tree.destroy(node);
+			_alloc_tree.deallocate(node, 1);
+		}
+
+		void						erase(iterator first, iterator last)
+		{
+			while (first != last)
+				erase(first++);
+		}
+
+		size_type					erase(const key_type& k)
+		{
+			k_tree *res = findnode(k);
+			if (res == NULL)
+				return (0);
+			erase(iterator(res, NULL, &_store));
+			return (1);
+		}
+
+		void						swap(split_map& x)
+		{
+			key_compare	tmp_comp = x._comp;
+			k_tree		*tmp_root = x._root;
+
+			x._comp = this->_comp;
+			x._root = this->_root;
+			this->_comp = tmp_comp;
+			this->_root = tmp_root;
+			this->_store.swap(x._store);
+		}
+
+		void						clear()
+		{
+			destroy_tree(_root);
+			_root = NULL;
+			_store.clear();
+		}
+
+		mapped_type& operator[] (const key_type& k)
+		{
+			return ((*((this->insert(ft::make_pair(k,mapped_type()))).first)).second);
+		}
+
+		allocator_type				get_allocator() const
+		{
+			return (_store.get_allocator());
+		}
+	};
+
+	template <class Key, class T, class Compare, class Alloc>
+		void swap (split_map<Key,T,Compare,Alloc>& x, split_map<Key,T,Compare,Alloc>& y)
+	{
+		x.swap(y);
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator== ( const split_map<Key,T,Compare,Alloc>& lco,
+					  const split_map<Key,T,Compare,Alloc>& rco )
+	{
+		if (lco.size() != rco.size())
+			return (false);
+		return (ft::equal(lco.begin(), lco.end(), rco.begin()));
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator!= ( const split_map<Key,T,Compare,Alloc>& lco,
+					  const split_map<Key,T,Compare,Alloc>& rco )
+	{
+		return (!(lco == rco));
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator<  ( const split_map<Key,T,Compare,Alloc>& lco,
+					  const split_map<Key,T,Compare,Alloc>& rco )
+	{
+		return (ft::lexicographical_compare(lco.begin(), lco.end(), rco.begin(), rco.end()));
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator<= ( const split_map<Key,T,Compare,Alloc>& lco,
+					  const split_map<Key,T,Compare,Alloc>& rco )
+	{
+		return (!(rco < lco));
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator>  ( const split_map<Key,T,Compare,Alloc>& lco,
+					  const split_map<Key,T,Compare,Alloc>& rco )
+	{
+		return (rco < lco);
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator>= ( const split_map<Key,T,Compare,Alloc>& lco,
+					  const split_map<Key,T,Compare,Alloc>& rco )
+	{
+		return (!(lco < rco));
+	}
+}
+
+#endif
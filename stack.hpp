@@ -1,10 +1,16 @@
 #ifndef STACK_HPP
 #define STACK_HPP
 
+#include <stdexcept>
+#include "iterator.hpp"
 #include "vector.hpp"
 
 namespace ft
 {
+	/* Tag for stack(c, ft::adopt): takes c's elements by swap, leaving c empty. */
+	struct adopt_t {};
+	static const adopt_t adopt = adopt_t();
+
 	template<class T, class Container = ft::vector<T> >
 	class stack
 	{
@@ -17,6 +23,15 @@ namespace ft
 	public:
 		explicit stack (const container_type& ctnr = container_type()) : contr(ctnr) {}
 
+		stack (container_type& ctnr, ft::adopt_t) : contr()
+		{
+			contr.swap(ctnr);
+		}
+
+#ifdef FT_CXX11
+		explicit stack (container_type&& ctnr) : contr(std::move(ctnr)) {}
+#endif
+
 		bool empty() const
         {
             return (contr.empty());
@@ -42,11 +57,60 @@ namespace ft
             contr.push_back(val);
         }
 
+#ifdef FT_CXX11
+		void push (value_type&& val)
+		{
+			contr.push_back(std::move(val));
+		}
+
+		template <class... Args>
+		void emplace (Args&&... args)
+		{
+			contr.emplace_back(std::forward<Args>(args)...);
+		}
+#endif
+
 		void pop()
         {
             contr.pop_back();
         }
 
+		/* Makes room for n elements in the container up front. */
+		void reserve (size_type n)
+		{
+			contr.reserve(n);
+		}
+
+		/* Pushes [first, last) with one insert; *(last - 1) ends up on top. */
+		template <class InputIterator>
+		void push_range (InputIterator first, InputIterator last)
+		{
+			contr.insert(contr.end(), first, last);
+		}
+
+		/*
+		** Pops the top n elements into out, top first, as n calls to top() and
+		** pop() would, then erases them with one erase. Throws out_of_range,
+		** and pops nothing, when the stack holds fewer than n elements.
+		*/
+		template <class OutputIterator>
+		OutputIterator pop_n (size_type n, OutputIterator out)
+		{
+			if (n > contr.size())
+				throw std::out_of_range("stack::pop_n");
+			typename container_type::iterator first = ft::prev(contr.end(), n);
+			for (typename container_type::iterator it = contr.end(); it != first; ++out)
+				*out = FT_MOVE(*--it);
+			contr.erase(first, contr.end());
+			return (out);
+		}
+
+		/* Hands the container's unused capacity back to the allocator. */
+		void shrink_to_fit()
+		{
+			contr.shrink_to_fit();
+		}
+
 		friend bool operator== (const stack<T,Container>& lco, const stack<T,Container>& rco)
 		{
 			return (lco.contr == rco.contr);
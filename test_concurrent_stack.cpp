@@ -0,0 +1,211 @@
+#include "concurrent_stack.hpp"
+#include "stack.hpp"
+#include <stack>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <time.h>
+#include <sys/time.h>
+#include <pthread.h>
+
+#define RED   "\x1b[31m"
+#define GREEN   "\x1b[32m"
+#define YELLOW  "\x1b[33m"
+#define BLUE    "\x1b[34m"
+#define MAGENTA "\x1b[35m"
+#define CYAN    "\x1b[36m"
+#define RESET   "\x1b[0m"
+
+static const long   per_thread = 200000;
+
+static long wall_usec(const struct timeval& start, const struct timeval& end)
+{
+    return ((end.tv_sec - start.tv_sec) * 1000000 + end.tv_usec - start.tv_usec);
+}
+
+static void print_check(const char *name, bool same)
+{
+    std::cout <<BLUE<< name << ": " <<RESET;
+    if (same)
+        std::cout << "ok" << std::endl;
+    else
+        std::cout <<RED<< "KO" <<RESET<< std::endl;
+}
+
+/* The mutex-guarded stack the concurrent one replaces. */
+template <class Stack>
+struct locked_stack
+{
+    pthread_mutex_t lock;
+    Stack           items;
+
+    locked_stack() { pthread_mutex_init(&lock, NULL); }
+    ~locked_stack() { pthread_mutex_destroy(&lock); }
+
+    void push(long val)
+    {
+        pthread_mutex_lock(&lock);
+        items.push(val);
+        pthread_mutex_unlock(&lock);
+    }
+
+    bool try_pop(long& out)
+    {
+        pthread_mutex_lock(&lock);
+        bool found = !items.empty();
+        if (found)
+        {
+            out = items.top();
+            items.pop();
+        }
+        pthread_mutex_unlock(&lock);
+        return (found);
+    }
+};
+
+struct mpmc
+{
+    ft::concurrent_stack<long>  *stack;
+    std::vector<unsigned char>  *seen;
+    long                        *popped;
+    long                        total;
+    long                        first;
+};
+
+static void *produce(void *arg)
+{
+    mpmc *m = static_cast<mpmc*>(arg);
+
+    for (long v = m->first; v != m->first + per_thread; v++)
+        m->stack->push(v);
+    return (NULL);
+}
+
+static void *consume(void *arg)
+{
+    mpmc    *m = static_cast<mpmc*>(arg);
+    long    v;
+
+    while (__atomic_load_n(m->popped, __ATOMIC_RELAXED) != m->total)
+    {
+        if (!m->stack->try_pop(v))
+            continue ;
+        __atomic_add_fetch(&(*m->seen)[v], 1, __ATOMIC_RELAXED);
+        __atomic_add_fetch(m->popped, 1, __ATOMIC_RELAXED);
+    }
+    return (NULL);
+}
+
+/* Every thread pushes and pops in turns, as users of a shared free list do. */
+template <class Stack>
+static void *push_pop(void *arg)
+{
+    Stack   *stack = static_cast<Stack*>(arg);
+    long    v;
+
+    for (long i = 0; i != per_thread; i++)
+    {
+        stack->push(i);
+        if (i % 4 != 0)
+            stack->try_pop(v);
+    }
+    while (stack->try_pop(v))
+        ;
+    return (NULL);
+}
+
+template <class Stack>
+static long bench(size_t threads)
+{
+    Stack               stack;
+    pthread_t           ids[8];
+    struct timeval      start;
+    struct timeval      end;
+
+    gettimeofday(&start, NULL);
+    for (size_t t = 0; t != threads; t++)
+        pthread_create(&ids[t], NULL, &push_pop<Stack>, &stack);
+    for (size_t t = 0; t != threads; t++)
+        pthread_join(ids[t], NULL);
+    gettimeofday(&end, NULL);
+    return (wall_usec(start, end));
+}
+
+int main()
+{
+    std::cout << GREEN << "*\n*\n*\n*\n**********TEST CONCURRENT_STACK**********\n*\n*\n*\n*" << RESET << std::endl;
+    std::cout << GREEN << "///TEST PUSH POP (one thread)///" << RESET << std::endl;
+    if (true)
+    {
+        ft::concurrent_stack<std::string>   ft_stack;
+        std::stack<std::string>             std_stack;
+        std::string                         ft_top;
+        bool                                same = true;
+
+        std::cout <<BLUE<< "empty: " <<RESET<< ft_stack.empty() << " | ";
+        std::cout <<BLUE<< "pop on empty: " <<RESET<< ft_stack.try_pop(ft_top) << std::endl;
+        for (int i = 0; i != 1000; i++)
+        {
+            ft_stack.push(std::string(i % 50 + 1, 'a' + i % 26));
+            std_stack.push(std::string(i % 50 + 1, 'a' + i % 26));
+            if (i % 3 == 0)
+            {
+                same &= ft_stack.try_pop(ft_top) && ft_top == std_stack.top();
+                std_stack.pop();
+            }
+        }
+        while (ft_stack.try_pop(ft_top))
+        {
+            same &= !std_stack.empty() && ft_top == std_stack.top();
+            std_stack.pop();
+        }
+        print_check("same order as std::stack", same && std_stack.empty());
+        print_check("cache-line aligned", __alignof__(ft_stack) == 64 && (size_t)&ft_stack % 64 == 0);
+        ft_stack.reserve(10000);
+        ft_stack.push("left for the destructor");
+        std::cout <<BLUE<< "empty after push: " <<RESET<< ft_stack.empty() << std::endl;
+    }
+    std::cout << GREEN << "///TEST MPMC (4 producers, 4 consumers, 200000 values each)///" << RESET << std::endl;
+    if (true)
+    {
+        ft::concurrent_stack<long>  ft_stack;
+        std::vector<unsigned char>  seen(4 * per_thread, 0);
+        long                        popped = 0;
+        mpmc                        args[4];
+        pthread_t                   producers[4];
+        pthread_t                   consumers[4];
+        bool                        once = true;
+
+        for (int t = 0; t != 4; t++)
+        {
+            mpmc m = { &ft_stack, &seen, &popped, 4 * per_thread, t * per_thread };
+            args[t] = m;
+        }
+        for (int t = 0; t != 4; t++)
+        {
+            pthread_create(&producers[t], NULL, &produce, &args[t]);
+            pthread_create(&consumers[t], NULL, &consume, &args[t]);
+        }
+        for (int t = 0; t != 4; t++)
+        {
+            pthread_join(producers[t], NULL);
+            pthread_join(consumers[t], NULL);
+        }
+        for (size_t v = 0; v != seen.size(); v++)
+            once &= (seen[v] == 1);
+        print_check("every value popped exactly once", once && ft_stack.empty());
+    }
+    std::cout << GREEN << "///TEST THROUGHPUT (200000 pushes + 150000 pops per thread)///" << RESET << std::endl;
+    if (true)
+    {
+        size_t  threads[] = { 1, 2, 4, 8 };
+
+        for (size_t i = 0; i != 4; i++)
+        {
+            std::cout <<MAGENTA<< "threads " << threads[i] << ": " <<RESET;
+            std::cout <<BLUE<< "ft::concurrent_stack: " <<RESET<< bench<ft::concurrent_stack<long> >(threads[i]) << " us | ";
+            std::cout <<BLUE<< "ft::stack + mutex: " <<RESET<< bench<locked_stack<ft::stack<long> > >(threads[i]) << " us | ";
+            std::cout <<BLUE<< "std::stack + mutex: " <<RESET<< bench<locked_stack<std::stack<long> > >(threads[i]) << " us" << std::endl;
+        }
+    }
+}
@@ -0,0 +1,148 @@
+#include "cow_vector.hpp"
+#include "vector.hpp"
+#include <vector>
+#include <string>
+#include <iostream>
+#include <time.h>
+#include <pthread.h>
+
+#define RED   "\x1b[31m"
+#define GREEN   "\x1b[32m"
+#define YELLOW  "\x1b[33m"
+#define BLUE    "\x1b[34m"
+#define MAGENTA "\x1b[35m"
+#define CYAN    "\x1b[36m"
+#define RESET   "\x1b[0m"
+
+template <class Ft, class Std>
+void print_vector(const Ft& ft_vector, const Std& std_vector)
+{
+    for (size_t i = 0; i != ft_vector.size() || i != std_vector.size(); i++)
+    {
+        if (i < ft_vector.size() && i < std_vector.size() && ft_vector[i] == std_vector[i])
+            std::cout <<MAGENTA<< "ft_cow: " <<RESET<< ft_vector[i] << " | ";
+        else if (i < ft_vector.size())
+            std::cout <<MAGENTA<< "ft_cow: " <<RED<< ft_vector[i] <<RESET<< " | ";
+        else
+            std::cout <<MAGENTA<< "ft_cow: " <<RED<< "NULL" <<RESET<< " | ";
+        if (i < std_vector.size())
+            std::cout <<MAGENTA<< "std_vector: " <<RESET<< std_vector[i] << std::endl;
+        else
+            std::cout <<MAGENTA<< "std_vector: " <<RED<< "NULL" <<RESET<< std::endl;
+    }
+}
+
+/* Config of 500 settings: 50000 snapshots, one setting added every 1000 of them. */
+template <class Vector>
+void bench_snapshots(const char *name)
+{
+    Vector      config;
+    size_t      total = 0;
+    clock_t     time;
+
+    for (int i = 0; i != 500; i++)
+        config.push_back(std::string(24, 'a' + i % 26));
+    time = clock();
+    for (int i = 0; i != 50000; i++)
+    {
+        const Vector snapshot(config);
+        total += snapshot[i % 500].size();
+        if (i % 1000 == 0)
+            config.push_back(std::string(8, 'n'));
+    }
+    time = clock() - time;
+    std::cout <<CYAN<< name <<RESET<< std::endl;
+    std::cout <<BLUE<< "checksum: " <<RESET<< total << " | ";
+    std::cout <<BLUE<< "time: " <<RESET<< time << std::endl;
+}
+
+static ft::cow_vector<std::string>  g_config(1000, std::string(16, 'c'));
+
+static void *take_snapshots(void *arg)
+{
+    size_t  *total = static_cast<size_t*>(arg);
+
+    for (int i = 0; i != 100000; i++)
+    {
+        ft::cow_vector<std::string> snapshot(g_config);
+        *total += snapshot.size();
+        if (i % 10000 == 0)
+            snapshot.push_back("local");
+    }
+    return (NULL);
+}
+
+int main()
+{
+    std::cout << GREEN << "*\n*\n*\n*\n**********TEST COW_VECTOR**********\n*\n*\n*\n*" << RESET << std::endl;
+    std::cout << GREEN << "///TEST SHARING & DETACH///" << RESET << std::endl;
+    if (true)
+    {
+        ft::cow_vector<std::string>     ft_cow1;
+        std::vector<std::string>        std_vector1;
+
+        for (int i = 0; i != 5; i++)
+        {
+            ft_cow1.push_back(std::string(i + 1, 'a' + i));
+            std_vector1.push_back(std::string(i + 1, 'a' + i));
+        }
+        ft::cow_vector<std::string>     ft_cow2(ft_cow1);
+        std::vector<std::string>        std_vector2(std_vector1);
+        std::cout <<BLUE<< "shared after copy: " <<RESET<< ft_cow1.use_count() << " | ";
+        ft_cow2.set(0, "changed");
+        std_vector2[0] = "changed";
+        ft_cow2.insert(ft_cow2.end(), 2, "tail");
+        std_vector2.insert(std_vector2.end(), 2, "tail");
+        std::cout <<BLUE<< "after write: " <<RESET<< ft_cow1.use_count() << " " << ft_cow2.use_count() << std::endl;
+        print_vector(ft_cow1, std_vector1);
+        print_vector(ft_cow2, std_vector2);
+
+        ft::cow_vector<std::string>     ft_cow3(ft_cow2);
+        size_t                          length = 0;
+        for (ft::cow_vector<std::string>::iterator it = ft_cow3.begin(); it != ft_cow3.end(); ++it)
+            length += it->size();
+        length += ft_cow3[0].size() + ft_cow3.front().size() + ft_cow3.back().size();
+        std::cout <<BLUE<< "shared after non-const reads: " <<RESET<< ft_cow2.use_count() << " | ";
+        std::cout <<BLUE<< "length: " <<RESET<< length << std::endl;
+
+        std::string                     &ref = ft_cow3.edit()[1];
+        ft::cow_vector<std::string>     ft_cow4(ft_cow3);
+        ref = "through reference";
+        std::cout <<BLUE<< "copy after edit(): " <<RESET<< ft_cow4[1] << " | ";
+        std::cout <<BLUE<< "use_count: " <<RESET<< ft_cow3.use_count() << " | ";
+        std::cout <<BLUE<< "==: " <<RESET<< (ft_cow2 == ft_cow4) << " | ";
+        std::cout <<BLUE<< "<: " <<RESET<< (ft_cow1 < ft_cow2) << std::endl;
+#ifdef FT_CXX11
+        ft::cow_vector<std::string>     ft_cow5(std::move(ft_cow4));
+        std::cout <<BLUE<< "move noexcept: " <<RESET<< noexcept(ft::cow_vector<std::string>(std::move(ft_cow5))) << " | ";
+        std::cout <<BLUE<< "moved-from size: " <<RESET<< ft_cow4.size() << " | ";
+        ft_cow4.push_back("reused");
+        std::cout <<BLUE<< "moved-from reused: " <<RESET<< ft_cow4[0] << " " << ft_cow4.use_count() << " | ";
+        std::cout <<BLUE<< "moved-to: " <<RESET<< ft_cow5[1] << std::endl;
+#endif
+    }
+    std::cout << GREEN << "///TEST SNAPSHOTS (500 strings, 50000 copies)///" << RESET << std::endl;
+    if (true)
+    {
+        bench_snapshots<ft::vector<std::string> >("ft::vector<std::string>");
+        bench_snapshots<ft::cow_vector<std::string> >("ft::cow_vector<std::string>");
+        bench_snapshots<std::vector<std::string> >("std::vector<std::string>");
+    }
+    std::cout << GREEN << "///TEST THREADS (4 x 100000 snapshots of one vector)///" << RESET << std::endl;
+    if (true)
+    {
+        pthread_t   threads[4];
+        size_t      totals[4] = { 0, 0, 0, 0 };
+        clock_t     time;
+
+        time = clock();
+        for (int i = 0; i != 4; i++)
+            pthread_create(&threads[i], NULL, take_snapshots, &totals[i]);
+        for (int i = 0; i != 4; i++)
+            pthread_join(threads[i], NULL);
+        time = clock() - time;
+        std::cout <<BLUE<< "total: " <<RESET<< totals[0] + totals[1] + totals[2] + totals[3] << " | ";
+        std::cout <<BLUE<< "use_count after: " <<RESET<< g_config.use_count() << " | ";
+        std::cout <<BLUE<< "time: " <<RESET<< time << std::endl;
+    }
+}
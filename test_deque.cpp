@@ -0,0 +1,173 @@
+#include "deque.hpp"
+#include "stack.hpp"
+#include <deque>
+#include <stack>
+#include <string>
+#include <iostream>
+#include <time.h>
+
+#define RED   "\x1b[31m"
+#define GREEN   "\x1b[32m"
+#define YELLOW  "\x1b[33m"
+#define BLUE    "\x1b[34m"
+#define MAGENTA "\x1b[35m"
+#define CYAN    "\x1b[36m"
+#define RESET   "\x1b[0m"
+
+template <class Ft, class Std>
+void print_deque(const Ft& ft_deque, const Std& std_deque)
+{
+    for (size_t i = 0; i != ft_deque.size() || i != std_deque.size(); i++)
+    {
+        if (i < ft_deque.size() && i < std_deque.size() && ft_deque[i] == std_deque[i])
+            std::cout <<MAGENTA<< "ft_deque: " <<RESET<< ft_deque[i] << " | ";
+        else if (i < ft_deque.size())
+            std::cout <<MAGENTA<< "ft_deque: " <<RED<< ft_deque[i] <<RESET<< " | ";
+        else
+            std::cout <<MAGENTA<< "ft_deque: " <<RED<< "NULL" <<RESET<< " | ";
+        if (i < std_deque.size())
+            std::cout <<MAGENTA<< "std_deque: " <<RESET<< std_deque[i] << std::endl;
+        else
+            std::cout <<MAGENTA<< "std_deque: " <<RED<< "NULL" <<RESET<< std::endl;
+    }
+    if (ft_deque.size() == std_deque.size())
+        std::cout <<BLUE<< "ft_deque size: " <<RESET<< ft_deque.size() << " | ";
+    else
+        std::cout <<BLUE<< "ft_deque size: " <<RED<< ft_deque.size() <<RESET<< " | ";
+    std::cout <<BLUE<< "std_deque size: " <<RESET<< std_deque.size() << std::endl;
+}
+
+static long nsec_since(const struct timespec& start)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((now.tv_sec - start.tv_sec) * 1000000000L + now.tv_nsec - start.tv_nsec);
+}
+
+/* Pushes n ints one by one; reports the total, the slowest push and the pushes over 100us. */
+template <class Stack>
+void bench_push_latency(const char *name, int n)
+{
+    Stack           stack;
+    struct timespec start;
+    long            worst = 0;
+    long            slow = 0;
+    clock_t         time;
+
+    time = clock();
+    for (int i = 0; i != n; i++)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        stack.push(i);
+        long took = nsec_since(start);
+        if (took > worst)
+            worst = took;
+        if (took > 100000)
+            slow++;
+    }
+    time = clock() - time;
+    std::cout <<CYAN<< name <<RESET<< std::endl;
+    std::cout <<BLUE<< "top: " <<RESET<< stack.top() << " | ";
+    std::cout <<BLUE<< "time: " <<RESET<< time << " | ";
+    std::cout <<BLUE<< "worst push (ns): " <<RESET<< worst << " | ";
+    std::cout <<BLUE<< "pushes over 100us: " <<RESET<< slow << std::endl;
+}
+
+int main()
+{
+    std::cout << GREEN << "*\n*\n*\n*\n**********TEST DEQUE**********\n*\n*\n*\n*" << RESET << std::endl;
+    std::cout << GREEN << "///TEST PUSH & POP AT BOTH ENDS///" << RESET << std::endl;
+    if (true)
+    {
+        ft::deque<std::string>  ft_deque1;
+        std::deque<std::string> std_deque1;
+
+        for (int i = 0; i != 4; i++)
+        {
+            ft_deque1.push_back(std::string(i + 1, 'b'));
+            std_deque1.push_back(std::string(i + 1, 'b'));
+            ft_deque1.push_front(std::string(i + 1, 'f'));
+            std_deque1.push_front(std::string(i + 1, 'f'));
+        }
+        print_deque(ft_deque1, std_deque1);
+        ft_deque1.pop_front();
+        std_deque1.pop_front();
+        ft_deque1.pop_back();
+        std_deque1.pop_back();
+        print_deque(ft_deque1, std_deque1);
+        std::cout <<BLUE<< "ft_deque front/back: " <<RESET<< ft_deque1.front() << " " << ft_deque1.back() << " | ";
+        std::cout <<BLUE<< "std_deque front/back: " <<RESET<< std_deque1.front() << " " << std_deque1.back() << std::endl;
+    }
+    std::cout << GREEN << "///TEST INSERT & ERASE///" << RESET << std::endl;
+    if (true)
+    {
+        ft::deque<int>  ft_deque1;
+        std::deque<int> std_deque1;
+        int             src[] = { 100, 200, 300 };
+
+        for (int i = 0; i != 10; i++)
+        {
+            ft_deque1.push_back(i);
+            std_deque1.push_back(i);
+        }
+        ft_deque1.insert(ft_deque1.begin() + 2, 2, -1);
+        std_deque1.insert(std_deque1.begin() + 2, 2, -1);
+        ft_deque1.insert(ft_deque1.end() - 1, src, src + 3);
+        std_deque1.insert(std_deque1.end() - 1, src, src + 3);
+        ft_deque1.erase(ft_deque1.begin() + 5);
+        std_deque1.erase(std_deque1.begin() + 5);
+        ft_deque1.erase(ft_deque1.begin() + 8, ft_deque1.begin() + 11);
+        std_deque1.erase(std_deque1.begin() + 8, std_deque1.begin() + 11);
+        print_deque(ft_deque1, std_deque1);
+
+        ft::deque<int>  ft_deque2(ft_deque1.rbegin(), ft_deque1.rend());
+        std::cout <<BLUE<< "ft_deque ==: " <<RESET<< (ft_deque1 == ft_deque2) << " | ";
+        std::cout <<BLUE<< "ft_deque <: " <<RESET<< (ft_deque1 < ft_deque2) << " | ";
+        std::cout <<BLUE<< "ft_deque distance: " <<RESET<< (ft_deque2.end() - ft_deque2.begin()) << std::endl;
+    }
+    std::cout << GREEN << "///TEST REFERENCE STABILITY (1M pushes at both ends)///" << RESET << std::endl;
+    if (true)
+    {
+        ft::deque<int>  ft_deque1(1, 42);
+        int             *first = &ft_deque1.front();
+
+        for (int i = 0; i != 500000; i++)
+        {
+            ft_deque1.push_back(i);
+            ft_deque1.push_front(-i);
+        }
+        std::cout <<BLUE<< "ft_deque size: " <<RESET<< ft_deque1.size() << " | ";
+        std::cout <<BLUE<< "same address: " <<RESET<< (first == &ft_deque1[500000]) << " | ";
+        std::cout <<BLUE<< "value: " <<RESET<< *first << std::endl;
+    }
+    std::cout << GREEN << "///TEST STACK ON DEQUE///" << RESET << std::endl;
+    if (true)
+    {
+        ft::stack<int, ft::deque<int> > ft_stack;
+        std::stack<int>                 std_stack;
+
+        for (int i = 0; i != 100000; i++)
+        {
+            ft_stack.push(i);
+            std_stack.push(i);
+        }
+        for (int i = 0; i != 99990; i++)
+        {
+            ft_stack.pop();
+            std_stack.pop();
+        }
+        ft_stack.shrink_to_fit();
+        std::cout <<BLUE<< "ft_stack top: " <<RESET<< ft_stack.top() << " | ";
+        std::cout <<BLUE<< "std_stack top: " <<RESET<< std_stack.top() << std::endl;
+        std::cout <<BLUE<< "ft_stack size: " <<RESET<< ft_stack.size() << " | ";
+        std::cout <<BLUE<< "std_stack size: " <<RESET<< std_stack.size() << std::endl;
+    }
+    std::cout << GREEN << "///TEST PUSH LATENCY (8M pushes)///" << RESET << std::endl;
+    if (true)
+    {
+        bench_push_latency<ft::stack<int> >("ft::stack<int> on ft::vector", 8000000);
+        bench_push_latency<ft::stack<int, ft::deque<int> > >("ft::stack<int> on ft::deque", 8000000);
+        bench_push_latency<std::stack<int> >("std::stack<int> on std::deque", 8000000);
+    }
+}
@@ -0,0 +1,106 @@
+#include "filtered_map.hpp"
+#include "split_map.hpp"
+#include "map.hpp"
+#include <vector>
+#include <iostream>
+#include <cstdlib>
+#include <time.h>
+
+#define RED   "\x1b[31m"
+#define GREEN   "\x1b[32m"
+#define YELLOW  "\x1b[33m"
+#define BLUE    "\x1b[34m"
+#define MAGENTA "\x1b[35m"
+#define CYAN    "\x1b[36m"
+#define RESET   "\x1b[0m"
+
+template <class Map>
+void bench_misses(const char *name, double fp_rate, const std::vector<int>& keys, const std::vector<int>& lookups)
+{
+    Map                         plain;
+    ft::filtered_map<Map>       filtered(fp_rate, keys.size());
+    long                        plain_hits = 0;
+    long                        filtered_hits = 0;
+    clock_t                     time_plain;
+    clock_t                     time_filtered;
+
+    for (size_t i = 0; i != keys.size(); i++)
+    {
+        plain.insert(ft::make_pair(keys[i], (int)i));
+        filtered.insert(ft::make_pair(keys[i], (int)i));
+    }
+    time_plain = clock();
+    for (size_t i = 0; i != lookups.size(); i++)
+        plain_hits += plain.count(lookups[i]);
+    time_plain = clock() - time_plain;
+    time_filtered = clock();
+    for (size_t i = 0; i != lookups.size(); i++)
+        filtered_hits += filtered.count(lookups[i]);
+    time_filtered = clock() - time_filtered;
+
+    typename ft::filtered_map<Map>::filter_stats stats = filtered.stats();
+    size_t misses = lookups.size() - filtered_hits;
+    std::cout <<CYAN<< name << " fp_rate " << fp_rate <<RESET<< std::endl;
+    if (plain_hits == filtered_hits)
+        std::cout <<BLUE<< "hits: " <<RESET<< filtered_hits << " | ";
+    else
+        std::cout <<BLUE<< "hits: " <<RED<< plain_hits << " / " << filtered_hits <<RESET<< " | ";
+    std::cout <<BLUE<< "filtered: " <<RESET<< stats.filtered << " | ";
+    std::cout <<BLUE<< "false positives: " <<RESET<< stats.false_positives
+              << " (" << (misses ? 100.0 * stats.false_positives / misses : 0.0) << "%)" << std::endl;
+    std::cout <<BLUE<< "plain time: " <<RESET<< time_plain << " | ";
+    std::cout <<BLUE<< "filtered time: " <<RESET<< time_filtered << std::endl;
+}
+
+int main()
+{
+    std::cout << GREEN << "*\n*\n*\n*\n**********TEST FILTERED_MAP**********\n*\n*\n*\n*" << RESET << std::endl;
+    std::cout << GREEN << "///TEST INSERT FIND ERASE///" << RESET << std::endl;
+    if (true)
+    {
+        ft::filtered_map<ft::map<int,int> > ft_map1(0.01, 4);
+        for (int i = 0; i != 100; i++)
+            ft_map1[i * 3] = i;
+        int found = 0;
+        for (int i = 0; i != 300; i++)
+            found += (ft_map1.find(i) != ft_map1.end());
+        std::cout <<BLUE<< "ft_filtered_map size: " <<RESET<< ft_map1.size() << " | ";
+        std::cout <<BLUE<< "found: " <<RESET<< found << " | ";
+        std::cout <<BLUE<< "expected: " <<RESET<< 100 << std::endl;
+        for (int i = 0; i < 300; i += 6)
+            ft_map1.erase(i);
+        found = 0;
+        for (int i = 0; i != 300; i++)
+            found += ft_map1.count(i);
+        std::cout <<BLUE<< "after erase found: " <<RESET<< found << " | ";
+        std::cout <<BLUE<< "expected: " <<RESET<< 50 << " | ";
+        std::cout <<BLUE<< "rebuilds: " <<RESET<< ft_map1.stats().rebuilds << std::endl;
+        ft_map1.erase(ft_map1.find(3));
+        ft_map1.erase(ft_map1.find(99), ft_map1.find(201));
+        found = 0;
+        for (int i = 0; i != 300; i++)
+            found += ft_map1.count(i);
+        std::cout <<BLUE<< "after iterator erase found: " <<RESET<< found << " | ";
+        std::cout <<BLUE<< "expected: " <<RESET<< 32 << " | ";
+        std::cout <<BLUE<< "size: " <<RESET<< ft_map1.size() << std::endl;
+    }
+    std::cout << GREEN << "///TEST MISS-HEAVY BENCHMARK///" << RESET << std::endl;
+    if (true)
+    {
+        std::vector<int> keys;
+        std::vector<int> lookups;
+        srand(42);
+        for (int i = 0; i != 100000; i++)
+            keys.push_back(rand());
+        for (int i = 0; i != 1000000; i++)
+        {
+            if (rand() % 100 < 15)
+                lookups.push_back(keys[rand() % keys.size()]);
+            else
+                lookups.push_back(rand());
+        }
+        bench_misses<ft::map<int,int> >("ft::map", 0.01, keys, lookups);
+        bench_misses<ft::split_map<int,int> >("ft::split_map", 0.01, keys, lookups);
+        bench_misses<ft::split_map<int,int> >("ft::split_map", 0.001, keys, lookups);
+    }
+}
@@ -0,0 +1,207 @@
+#include "vector.hpp"
+#include "map.hpp"
+#include <iostream>
+#include <time.h>
+
+#define RED   "\x1b[31m"
+#define GREEN   "\x1b[32m"
+#define YELLOW  "\x1b[33m"
+#define BLUE    "\x1b[34m"
+#define MAGENTA "\x1b[35m"
+#define CYAN    "\x1b[36m"
+#define RESET   "\x1b[0m"
+
+/* Built with -O2 (see Makefile): iterator loops must run as fast as pointer loops. */
+typedef ft::vector<int>::iterator                   vec_iterator;
+typedef ft::vector<int>::const_iterator             vec_const_iterator;
+typedef ft::vector<int>::reverse_iterator           vec_reverse_iterator;
+typedef ft::map<int, int>::iterator                 map_iterator;
+
+typedef char iterator_is_a_pointer[sizeof(vec_iterator) == sizeof(int*) ? 1 : -1];
+typedef char reverse_iterator_is_a_pointer[sizeof(vec_reverse_iterator) == sizeof(int*) ? 1 : -1];
+typedef char iterator_is_trivial[ft::is_trivially_copyable<vec_iterator>::value ? 1 : -1];
+typedef char const_iterator_is_trivial[ft::is_trivially_copyable<vec_const_iterator>::value ? 1 : -1];
+typedef char reverse_iterator_is_trivial[ft::is_trivially_copyable<vec_reverse_iterator>::value ? 1 : -1];
+typedef char map_iterator_is_trivial[ft::is_trivially_copyable<map_iterator>::value ? 1 : -1];
+
+static const int    size = 4096;
+static const int    rounds = 2000;
+static const int    tries = 51;
+static const int    measurements = 5;
+static const double tolerance = 1.05;
+
+template <class Iter>
+__attribute__((noinline)) int sum(Iter first, Iter last)
+{
+    int total = 0;
+
+    for (; first != last; ++first)
+        total += *first;
+    return (total);
+}
+
+template <class In, class Out>
+__attribute__((noinline)) Out scale(In first, In last, Out out, int a)
+{
+    for (; first != last; ++first, ++out)
+        *out = a * *first;
+    return (out);
+}
+
+template <class Iter>
+__attribute__((noinline)) int reverse_sum(Iter first, Iter last)
+{
+    int total = 0;
+
+    while (last != first)
+        total += *--last;
+    return (total);
+}
+
+template <class Iter>
+__attribute__((noinline)) int indexed_sum(Iter first, int n)
+{
+    int total = 0;
+
+    for (int i = 0; i != n; i++)
+        total += first[i];
+    return (total);
+}
+
+static volatile int sink;
+
+static void report(const char *name, clock_t iterator_time, clock_t pointer_time, bool ok)
+{
+    std::cout <<CYAN<< name <<RESET<< " | ";
+    std::cout <<BLUE<< "iterator time: " <<RESET<< iterator_time << " | ";
+    std::cout <<BLUE<< "pointer time: " <<RESET<< pointer_time << " | ";
+    if (ok)
+        std::cout <<GREEN<< "ok" <<RESET<< std::endl;
+    else
+        std::cout <<RED<< "iterator slower by more than 5%" <<RESET<< std::endl;
+}
+
+template <class Loop>
+static clock_t run(Loop loop)
+{
+    clock_t time = clock();
+
+    for (int r = 0; r != rounds; r++)
+        sink = loop(r);
+    return (clock() - time);
+}
+
+/*
+** Best of many short runs of each, taken in turns so that a stray context
+** switch or a change of clock speed hits both; a loop only fails when it
+** is slower in several measurements in a row, as slower code always is.
+*/
+template <class IteratorLoop, class PointerLoop>
+static bool compare(const char *name, IteratorLoop iterator_loop, PointerLoop pointer_loop)
+{
+    clock_t iterator_time = 0;
+    clock_t pointer_time = 0;
+    bool    ok = false;
+
+    for (int m = 0; m != measurements && !ok; m++)
+    {
+        for (int t = 0; t != tries; t++)
+        {
+            clock_t time = run(pointer_loop);
+            if (t == 0 || time < pointer_time)
+                pointer_time = time;
+            time = run(iterator_loop);
+            if (t == 0 || time < iterator_time)
+                iterator_time = time;
+        }
+        ok = iterator_time <= pointer_time * tolerance + 1;
+    }
+    report(name, iterator_time, pointer_time, ok);
+    return (ok);
+}
+
+struct sum_iterator
+{
+    ft::vector<int> *v;
+    int operator()(int) const { return (sum(v->begin(), v->end())); }
+};
+
+struct sum_pointer
+{
+    ft::vector<int> *v;
+    int operator()(int) const { return (sum(v->data(), v->data() + v->size())); }
+};
+
+struct scale_iterator
+{
+    ft::vector<int> *x;
+    ft::vector<int> *y;
+    int operator()(int r) const { scale(x->begin(), x->end(), y->begin(), r & 3); return ((*y)[r % size]); }
+};
+
+struct scale_pointer
+{
+    ft::vector<int> *x;
+    ft::vector<int> *y;
+    int operator()(int r) const { scale(x->data(), x->data() + x->size(), y->data(), r & 3); return ((*y)[r % size]); }
+};
+
+struct reverse_iterator_sum
+{
+    ft::vector<int> *v;
+    int operator()(int) const { return (sum(v->rbegin(), v->rend())); }
+};
+
+struct reverse_pointer_sum
+{
+    ft::vector<int> *v;
+    int operator()(int) const { return (reverse_sum(v->data(), v->data() + v->size())); }
+};
+
+struct indexed_iterator
+{
+    ft::vector<int> *v;
+    int operator()(int) const { return (indexed_sum(v->begin(), size)); }
+};
+
+struct indexed_pointer
+{
+    ft::vector<int> *v;
+    int operator()(int) const { return (indexed_sum(v->data(), size)); }
+};
+
+int main()
+{
+    ft::vector<int> x;
+    ft::vector<int> y(size, 1);
+    bool            ok = true;
+
+    for (int i = 0; i != size; i++)
+        x.push_back(i * 7 % 1000);
+    std::cout << GREEN << "*\n*\n*\n*\n**********TEST ITERATOR**********\n*\n*\n*\n*" << RESET << std::endl;
+    std::cout << GREEN << "///TEST SAME RESULTS///" << RESET << std::endl;
+    if (true)
+    {
+        std::cout <<BLUE<< "sum: " <<RESET<< (sum(x.begin(), x.end()) == sum(x.data(), x.data() + size)) << " | ";
+        std::cout <<BLUE<< "reverse sum: " <<RESET<< (sum(x.rbegin(), x.rend()) == reverse_sum(x.data(), x.data() + size)) << " | ";
+        std::cout <<BLUE<< "indexed sum: " <<RESET<< (indexed_sum(x.begin(), size) == indexed_sum(x.data(), size)) << std::endl;
+    }
+    std::cout << GREEN << "///TEST LOOP THROUGHPUT (4096 ints x 2000, best of 51)///" << RESET << std::endl;
+    if (true)
+    {
+        sum_iterator            si = { &x };
+        sum_pointer             sp = { &x };
+        scale_iterator          xi = { &x, &y };
+        scale_pointer           xp = { &x, &y };
+        reverse_iterator_sum    ri = { &x };
+        reverse_pointer_sum     rp = { &x };
+        indexed_iterator        ii = { &x };
+        indexed_pointer         ip = { &x };
+
+        ok &= compare("sum", si, sp);
+        ok &= compare("scale", xi, xp);
+        ok &= compare("reverse sum", ri, rp);
+        ok &= compare("indexed sum", ii, ip);
+    }
+    return (ok ? 0 : 1);
+}
@@ -1,11 +1,16 @@
 #include "vector.hpp"
 #include <vector>
 #include <iostream>
+#include <string>
 #include <time.h>
 #include <stack>
 #include "stack.hpp"
 #include "map.hpp"
+#include "aligned_allocator.hpp"
 #include <map>
+#include <cstdlib>
+#include <sys/time.h>
+#include <pthread.h>
 
 #define RED   "\x1b[31m"
 #define GREEN   "\x1b[32m"
@@ -47,7 +52,7 @@ void print_map_int(ft::map<int,int>::iterator ft_it, std::map<int,int>::iterator
         std::cout <<BLUE<< "ft_map size: " <<RED<< ft_map.size() <<RESET<< " | ";
     std::cout <<BLUE<< "std_map size: " <<RESET<< std_map.size() << std::endl;
 
-    if (time_ft / time_std >= 20)
+    if (time_std != 0 && time_ft / time_std >= 20)
         std::cout << RED<<"YOUR TIME IS SO BAD" <<RESET<< std::endl;
     else if (time_ft > time_std)
     {
@@ -66,6 +71,54 @@ void print_map_int(ft::map<int,int>::iterator ft_it, std::map<int,int>::iterator
     }
 }
 
+/* Runs fn on a thread with a 128 KB stack, where one frame per tree level would not fit. */
+bool run_on_small_stack(void *(*fn)(void *), void *arg)
+{
+    pthread_attr_t  attr;
+    pthread_t       id;
+    void            *ok;
+
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, 128 * 1024);
+    if (pthread_create(&id, &attr, fn, arg) != 0)
+        return (false);
+    pthread_attr_destroy(&attr);
+    pthread_join(id, &ok);
+    return (ok != NULL);
+}
+
+/* Splits a map filled in ascending order, so the tree is a single right spine. */
+void *split_chain(void *arg)
+{
+    ft::map<int,int>    *chain = static_cast<ft::map<int,int> *>(arg);
+    size_t              n = chain->size();
+    ft::map<int,int>    upper;
+
+    chain->split((int)n - 1, upper);
+
+    if (chain->size() != n - 1 || upper.size() != 1 || upper.begin()->first != (int)n - 1)
+        return (NULL);
+    chain->join(upper);
+    return (chain->size() == n ? arg : NULL);
+}
+
+/* Exports a map filled in descending order, so the tree is a single left spine. */
+void *export_chain(void *arg)
+{
+    ft::map<int,int>                *chain = static_cast<ft::map<int,int> *>(arg);
+    ft::vector<int>                 keys;
+    ft::vector<int>                 values;
+    ft::vector<ft::pair<int, int> > range;
+
+    chain->keys_to(keys);
+    chain->values_to(values, 4);
+    chain->copy_range_to(0, (int)chain->size(), range);
+    for (size_t i = 0; i != chain->size(); i++)
+        if (keys[i] != (int)i || values[i] != (int)i || range[i].first != (int)i)
+            return (NULL);
+    return (keys.size() == chain->size() && range.size() == chain->size() ? arg : NULL);
+}
+
 int main()
 {
     std::cout << GREEN << "*\n*\n*\n*\n**********TEST MAP**********\n*\n*\n*\n*" << RESET << std::endl;
@@ -213,4 +266,253 @@ int main()
         std::cout <<BLUE<< "ft_map >=: " <<RESET<< (ft_map2 >= ft_map1) << " | ";
         std::cout <<BLUE<< "std_map >=: " <<RESET<< (std_map2 >= std_map1) << std::endl;
     }
+    std::cout <<GREEN<< "//TEST CURSOR & LOOKUP CACHE///" <<RESET<< std::endl;
+    if (true)
+    {
+        ft::map<int,int> ft_map2;
+        std::map<int,int> std_map2;
+        std::vector<int> trace;
+        long ft_sum = 0;
+        long cursor_sum = 0;
+        long cache_sum = 0;
+        long std_sum = 0;
+        clock_t time_cursor;
+        clock_t time_cache;
+
+        srand(42);
+        for (int i = 0; i != 100000; i++)
+        {
+            int k = rand() % 1000000;
+            ft_map2.insert(ft::pair<int, int>(k, i));
+            std_map2.insert(std::pair<int, int>(k, i));
+        }
+        for (std::map<int,int>::iterator it = std_map2.begin(); it != std_map2.end(); it++)
+            trace.push_back(it->first);
+        std::vector<int> local;
+        for (size_t i = 0, pos = trace.size() / 2; i != 1000000; i++)
+        {
+            pos = (pos + trace.size() + rand() % 7 - 3) % trace.size();
+            local.push_back(trace[pos]);
+            if (rand() % 2)
+                local.push_back(trace[pos]);
+        }
+        time_ft = clock();
+        for (size_t i = 0; i != local.size(); i++)
+            ft_sum += ft_map2.find(local[i])->second;
+        time_ft = clock() - time_ft;
+        ft::map<int,int>::cursor cursor(ft_map2);
+        time_cursor = clock();
+        for (size_t i = 0; i != local.size(); i++)
+            cursor_sum += cursor.seek(local[i])->second;
+        time_cursor = clock() - time_cursor;
+        ft_map2.lookup_cache(true);
+        time_cache = clock();
+        for (size_t i = 0; i != local.size(); i++)
+            cache_sum += ft_map2.find(local[i])->second;
+        time_cache = clock() - time_cache;
+        time_std = clock();
+        for (size_t i = 0; i != local.size(); i++)
+            std_sum += std_map2.find(local[i])->second;
+        time_std = clock() - time_std;
+        std::cout <<BLUE<< "ft_map find sum: " <<RESET<< ft_sum << " | ";
+        std::cout <<BLUE<< "ft_map cursor sum: " <<RESET<< cursor_sum << " | ";
+        std::cout <<BLUE<< "ft_map cache sum: " <<RESET<< cache_sum << " | ";
+        std::cout <<BLUE<< "std_map find sum: " <<RESET<< std_sum << std::endl;
+        std::cout <<BLUE<< "ft_map find time: " <<RESET<< time_ft << " | ";
+        std::cout <<BLUE<< "ft_map cursor time: " <<RESET<< time_cursor << " | ";
+        std::cout <<BLUE<< "ft_map cache time: " <<RESET<< time_cache << " | ";
+        std::cout <<BLUE<< "std_map find time: " <<RESET<< time_std << std::endl;
+        ft::map<int,int>::cursor unbound;
+        std::cout <<BLUE<< "default cursor seek: " <<RESET<< (unbound.seek(1) == ft::map<int,int>::iterator()) << std::endl;
+    }
+    std::cout <<GREEN<< "//TEST SPLIT & JOIN///" <<RESET<< std::endl;
+    if (true)
+    {
+        ft::map<int,int> ft_map2;
+        std::map<int,int> std_map2;
+        for (int i = 0; i != 20; i++)
+        {
+            ft_map2.insert(ft::pair<int, int>((i * 7) % 20, i));
+            std_map2.insert(std::pair<int, int>((i * 7) % 20, i));
+        }
+        ft::map<int,int> ft_map3;
+        ft_map3[99] = 99;
+        time_ft = clock();
+        ft_map2.split(12, ft_map3);
+        time_ft = clock() - time_ft;
+        time_std = clock();
+        std::map<int,int> std_map3(std_map2.lower_bound(12), std_map2.end());
+        std_map2.erase(std_map2.lower_bound(12), std_map2.end());
+        time_std = clock() - time_std;
+        print_map_int(ft_it, std_it, ft_map2, std_map2, time_ft, time_std);
+        print_map_int(ft_it, std_it, ft_map3, std_map3, time_ft, time_std);
+        time_ft = clock();
+        ft_map3.join(ft_map2);
+        time_ft = clock() - time_ft;
+        time_std = clock();
+        std_map3.insert(std_map2.begin(), std_map2.end());
+        std_map2.clear();
+        time_std = clock() - time_std;
+        print_map_int(ft_it, std_it, ft_map3, std_map3, time_ft, time_std);
+        std::cout <<BLUE<< "ft_map joined-from size: " <<RESET<< ft_map2.size() << " | ";
+        std::cout <<BLUE<< "std_map joined-from size: " <<RESET<< std_map2.size() << std::endl;
+    }
+    std::cout <<GREEN<< "//TEST SPLIT & JOIN 200000///" <<RESET<< std::endl;
+    if (true)
+    {
+        ft::map<int,int> ft_map2;
+        std::map<int,int> std_map2;
+        srand(42);
+        for (int i = 0; i != 200000; i++)
+        {
+            int k = rand();
+            ft_map2.insert(ft::pair<int, int>(k, i));
+            std_map2.insert(std::pair<int, int>(k, i));
+        }
+        ft::map<int,int> ft_map3;
+        time_ft = clock();
+        ft_map2.split(RAND_MAX / 2, ft_map3);
+        time_ft = clock() - time_ft;
+        time_std = clock();
+        std::map<int,int> std_map3(std_map2.lower_bound(RAND_MAX / 2), std_map2.end());
+        std_map2.erase(std_map2.lower_bound(RAND_MAX / 2), std_map2.end());
+        time_std = clock() - time_std;
+        std::cout <<BLUE<< "ft_map split sizes: " <<RESET<< ft_map2.size() << " + " << ft_map3.size() << " | ";
+        std::cout <<BLUE<< "std_map split sizes: " <<RESET<< std_map2.size() << " + " << std_map3.size() << std::endl;
+        std::cout <<BLUE<< "ft_map split time: " <<RESET<< time_ft << " | ";
+        std::cout <<BLUE<< "std_map split time: " <<RESET<< time_std << std::endl;
+        time_ft = clock();
+        ft_map2.join(ft_map3);
+        time_ft = clock() - time_ft;
+        time_std = clock();
+        std_map2.insert(std_map3.begin(), std_map3.end());
+        time_std = clock() - time_std;
+        std::cout <<BLUE<< "ft_map joined size: " <<RESET<< ft_map2.size() << " | ";
+        std::cout <<BLUE<< "std_map joined size: " <<RESET<< std_map2.size() << std::endl;
+        std::cout <<BLUE<< "ft_map join time: " <<RESET<< time_ft << " | ";
+        std::cout <<BLUE<< "std_map join time: " <<RESET<< time_std << std::endl;
+    }
+    std::cout <<GREEN<< "//TEST SPLIT ASCENDING CHAIN 30000///" <<RESET<< std::endl;
+    if (true)
+    {
+        ft::map<int,int> ft_chain;
+        for (int i = 0; i != 30000; i++)
+            ft_chain.insert(ft::pair<int, int>(i, i));
+        std::cout <<BLUE<< "ft_map split on a 128 KB stack: " <<RESET<< run_on_small_stack(&split_chain, &ft_chain) << std::endl;
+    }
+    std::cout <<GREEN<< "//TEST EXPORT DESCENDING CHAIN 10000///" <<RESET<< std::endl;
+    if (true)
+    {
+        ft::map<int,int> ft_chain;
+        for (int i = 9999; i >= 0; i--)
+            ft_chain.insert(ft::pair<int, int>(i, i));
+        std::cout <<BLUE<< "ft_map export on a 128 KB stack: " <<RESET<< run_on_small_stack(&export_chain, &ft_chain) << std::endl;
+    }
+    std::cout <<GREEN<< "//TEST BULK EXPORT 500000///" <<RESET<< std::endl;
+    if (true)
+    {
+        ft::map<int,int> ft_map2;
+        std::map<int,int> std_map2;
+        ft::vector<int> ft_keys;
+        ft::vector<int> ft_values;
+        ft::vector<int> ft_keys4;
+        ft::vector<int> ft_loop;
+        ft::vector<ft::pair<int, int> > ft_range;
+        std::vector<int> std_keys;
+        clock_t time_loop;
+        clock_t time_export4;
+        srand(42);
+        for (int i = 0; i != 500000; i++)
+        {
+            int k = rand();
+            ft_map2.insert(ft::pair<int, int>(k, i));
+            std_map2.insert(std::pair<int, int>(k, i));
+        }
+        time_loop = clock();
+        for (ft::map<int,int>::iterator it = ft_map2.begin(); it != ft_map2.end(); it++)
+            ft_loop.push_back(it->first);
+        time_loop = clock() - time_loop;
+        struct timeval wall_start;
+        struct timeval wall_end;
+        gettimeofday(&wall_start, NULL);
+        ft_map2.keys_to(ft_keys);
+        gettimeofday(&wall_end, NULL);
+        time_ft = (wall_end.tv_sec - wall_start.tv_sec) * 1000000 + wall_end.tv_usec - wall_start.tv_usec;
+        gettimeofday(&wall_start, NULL);
+        ft_map2.keys_to(ft_keys4, 4);
+        gettimeofday(&wall_end, NULL);
+        time_export4 = (wall_end.tv_sec - wall_start.tv_sec) * 1000000 + wall_end.tv_usec - wall_start.tv_usec;
+        ft_map2.values_to(ft_values, 4);
+        time_std = clock();
+        for (std::map<int,int>::iterator it = std_map2.begin(); it != std_map2.end(); it++)
+            std_keys.push_back(it->first);
+        time_std = clock() - time_std;
+        bool same = ft_keys.size() == std_keys.size() && ft_keys4.size() == std_keys.size()
+            && ft_values.size() == std_keys.size();
+        for (size_t i = 0; same && i != std_keys.size(); i++)
+            same = ft_keys[i] == std_keys[i] && ft_keys4[i] == std_keys[i] && ft_values[i] == std_map2[std_keys[i]];
+        std::cout <<BLUE<< "ft_map export matches std_map: " <<RESET<< same << std::endl;
+        std::cout <<BLUE<< "ft_map iterate time: " <<RESET<< time_loop << " | ";
+        std::cout <<BLUE<< "ft_map keys_to wall time: " <<RESET<< time_ft << " | ";
+        std::cout <<BLUE<< "ft_map keys_to(4) wall time: " <<RESET<< time_export4 << " | ";
+        std::cout <<BLUE<< "std_map iterate time: " <<RESET<< time_std << std::endl;
+        size_t n = ft_map2.copy_range_to(RAND_MAX / 4, RAND_MAX / 2, ft_range);
+        size_t std_n = std::distance(std_map2.lower_bound(RAND_MAX / 4), std_map2.lower_bound(RAND_MAX / 2));
+        std::cout <<BLUE<< "ft_map copy_range_to: " <<RESET<< n << " " << ft_range.size() << " | ";
+        std::cout <<BLUE<< "std_map range: " <<RESET<< std_n << std::endl;
+        std::cout <<BLUE<< "ft_map rank: " <<RESET<< ft_map2.rank(RAND_MAX / 2) << " | ";
+        std::cout <<BLUE<< "std_map rank: " <<RESET<< std::distance(std_map2.begin(), std_map2.lower_bound(RAND_MAX / 2)) << std::endl;
+    }
+    std::cout <<GREEN<< "//TEST NODES FROM Alloc (aligned_allocator<64>)///" <<RESET<< std::endl;
+    if (true)
+    {
+        typedef ft::aligned_allocator<ft::pair<const int, int>, 64>  aligned;
+        ft::map<int, int, ft::less<int>, aligned>    ft_aligned;
+        std::map<int, int>                            std_aligned;
+        bool                                          all_aligned = true;
+
+        for (int i = 0; i != 100; i++)
+        {
+            ft_aligned.insert(ft::make_pair((i * 37) % 100, i));
+            std_aligned.insert(std::make_pair((i * 37) % 100, i));
+        }
+        ft_aligned.erase(ft_aligned.begin());
+        std_aligned.erase(std_aligned.begin());
+        ft_aligned.erase(ft_aligned.find(50), ft_aligned.find(60));
+        std_aligned.erase(std_aligned.find(50), std_aligned.find(60));
+        bool same = ft_aligned.size() == std_aligned.size();
+        std::map<int, int>::iterator std_it = std_aligned.begin();
+        for (ft::map<int, int, ft::less<int>, aligned>::iterator it = ft_aligned.begin(); same && it != ft_aligned.end(); it++, std_it++)
+        {
+            same = it->first == std_it->first && it->second == std_it->second;
+            all_aligned &= ((size_t)&*it % 64 == 0);
+        }
+        std::cout <<BLUE<< "ft_map matches std_map: " <<RESET<< same << " | ";
+        std::cout <<BLUE<< "every node 64-byte aligned: " <<RESET<< all_aligned << std::endl;
+    }
+#ifdef FT_CXX11
+    std::cout <<GREEN<< "//TEST EMPLACE & RVALUE INSERT///" <<RESET<< std::endl;
+    if (true)
+    {
+        ft::map<int, std::string>             ft_map2;
+        std::map<int, std::string>              std_map2;
+        std::string                             ft_str(40, 'a');
+        std::string                             std_str(40, 'a');
+        ft::pair<const int, std::string>        ft_entry(2, std::string(40, 'b'));
+        std::pair<const int, std::string>       std_entry(2, std::string(40, 'b'));
+
+        std::cout <<BLUE<< "ft emplace: " <<RESET<< ft_map2.emplace(1, std::move(ft_str)).second << " | ";
+        std::cout <<BLUE<< "std emplace: " <<RESET<< std_map2.emplace(1, std::move(std_str)).second << std::endl;
+        std::cout <<BLUE<< "ft moved-from size: " <<RESET<< ft_str.size() << " | ";
+        std::cout <<BLUE<< "std moved-from size: " <<RESET<< std_str.size() << std::endl;
+        std::cout <<BLUE<< "ft insert rvalue: " <<RESET<< ft_map2.insert(std::move(ft_entry)).second << " | ";
+        std::cout <<BLUE<< "std insert rvalue: " <<RESET<< std_map2.insert(std::move(std_entry)).second << std::endl;
+        std::cout <<BLUE<< "ft moved-from size: " <<RESET<< ft_entry.second.size() << " | ";
+        std::cout <<BLUE<< "std moved-from size: " <<RESET<< std_entry.second.size() << std::endl;
+        std::cout <<BLUE<< "ft emplace duplicate: " <<RESET<< ft_map2.emplace(1, "dup").second << " | ";
+        std::cout <<BLUE<< "std emplace duplicate: " <<RESET<< std_map2.emplace(1, "dup").second << std::endl;
+        std::cout <<BLUE<< "ft values: " <<RESET<< ft_map2[1].size() << " " << ft_map2[2].size() << " | ";
+        std::cout <<BLUE<< "std values: " <<RESET<< std_map2[1].size() << " " << std_map2[2].size() << std::endl;
+    }
+#endif
 }
\ No newline at end of file
@@ -0,0 +1,186 @@
+#include "mapped_vector.hpp"
+#include "vector.hpp"
+#include <vector>
+#include <iostream>
+#include <time.h>
+#include <stdio.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define RED   "\x1b[31m"
+#define GREEN   "\x1b[32m"
+#define YELLOW  "\x1b[33m"
+#define BLUE    "\x1b[34m"
+#define MAGENTA "\x1b[35m"
+#define CYAN    "\x1b[36m"
+#define RESET   "\x1b[0m"
+
+struct entry
+{
+    long    key;
+    double  weight;
+};
+
+/* The lookup table the benchmark rebuilds or reopens */
+static entry make_entry(long i)
+{
+    entry e;
+
+    e.key = i * 31 % 1000003;
+    e.weight = i * 0.5;
+    return (e);
+}
+
+int main()
+{
+    const char  *path = "/tmp/ft_mapped_vector.dat";
+
+    unlink(path);
+    std::cout << GREEN << "*\n*\n*\n*\n**********TEST MAPPED_VECTOR**********\n*\n*\n*\n*" << RESET << std::endl;
+    std::cout << GREEN << "///TEST PERSISTENCE///" << RESET << std::endl;
+    if (true)
+    {
+        std::vector<int>    std_vector;
+
+        {
+            ft::mapped_vector<int>  ft_mapped(path);
+
+            for (int i = 0; i != 10; i++)
+            {
+                ft_mapped.push_back(i * i);
+                std_vector.push_back(i * i);
+            }
+            ft_mapped.insert(ft_mapped.begin() + 3, -1);
+            std_vector.insert(std_vector.begin() + 3, -1);
+            ft_mapped.erase(ft_mapped.begin() + 6, ft_mapped.begin() + 8);
+            std_vector.erase(std_vector.begin() + 6, std_vector.begin() + 8);
+            ft_mapped.pop_back();
+            std_vector.pop_back();
+            ft_mapped.flush();
+        }
+        ft::mapped_vector<int>          ft_file(path, ft::mapped_vector<int>::read_only);
+        const ft::mapped_vector<int>    &ft_mapped = ft_file;
+        for (size_t i = 0; i != ft_mapped.size() || i != std_vector.size(); i++)
+        {
+            if (i < ft_mapped.size() && i < std_vector.size() && ft_mapped[i] == std_vector[i])
+                std::cout <<MAGENTA<< "ft_mapped: " <<RESET<< ft_mapped[i] << " | ";
+            else if (i < ft_mapped.size())
+                std::cout <<MAGENTA<< "ft_mapped: " <<RED<< ft_mapped[i] <<RESET<< " | ";
+            else
+                std::cout <<MAGENTA<< "ft_mapped: " <<RED<< "NULL" <<RESET<< " | ";
+            if (i < std_vector.size())
+                std::cout <<MAGENTA<< "std_vector: " <<RESET<< std_vector[i] << std::endl;
+            else
+                std::cout <<MAGENTA<< "std_vector: " <<RED<< "NULL" <<RESET<< std::endl;
+        }
+        std::cout <<BLUE<< "reopened size: " <<RESET<< ft_mapped.size() << " | ";
+        std::cout <<BLUE<< "std_vector size: " <<RESET<< std_vector.size() << " | ";
+        std::cout <<BLUE<< "algorithms: " <<RESET<< ft::equal(ft_mapped.begin(), ft_mapped.end(), std_vector.begin()) << std::endl;
+        try
+        {
+            ft_file.push_back(1);
+            std::cout <<BLUE<< "read-only push_back: " <<RED<< "accepted" <<RESET<< std::endl;
+        }
+        catch (const std::logic_error& e)
+        {
+            std::cout <<BLUE<< "read-only push_back: " <<RESET<< e.what() << std::endl;
+        }
+        try
+        {
+            ft::mapped_vector<entry>    wrong_type(path, ft::mapped_vector<entry>::read_only);
+        }
+        catch (const std::runtime_error& e)
+        {
+            std::cout <<BLUE<< "open as another type: " <<RESET<< e.what() << std::endl;
+        }
+    }
+    unlink(path);
+    std::cout << GREEN << "///TEST SHARED READERS///" << RESET << std::endl;
+    if (true)
+    {
+        ft::mapped_vector<long>     ft_writer(path);
+        ft::mapped_vector<long>         ft_reader;
+        const ft::mapped_vector<long>   &reader = ft_reader;
+        long                            sum = 0;
+
+        ft_writer.reserve(1 << 20);
+        for (long i = 0; i != 1000; i++)
+            ft_writer.push_back(i);
+        ft_reader.open(path, ft::mapped_vector<long>::read_only);
+        ft_writer[0] = 42;
+        for (int i = 0; i != 1000; i++)
+            sum += i;
+        pid_t pid = fork();
+        if (pid == 0)
+        {
+            const ft::mapped_vector<long>   child(path, ft::mapped_vector<long>::read_only);
+            long                            child_sum = 0;
+
+            for (size_t i = 0; i != child.size(); i++)
+                child_sum += child[i];
+            _exit(child_sum == sum + 42 ? 0 : 1);
+        }
+        int status = 1;
+        waitpid(pid, &status, 0);
+        std::cout <<BLUE<< "reader sees writer store: " <<RESET<< (reader[0] == 42) << " | ";
+        std::cout <<BLUE<< "reader size: " <<RESET<< ft_reader.size() << " | ";
+        std::cout <<BLUE<< "other process sum ok: " <<RESET<< (WIFEXITED(status) && WEXITSTATUS(status) == 0) << std::endl;
+        try
+        {
+            ft_reader[0] = 7;
+            std::cout <<BLUE<< "write through a reader: " <<RED<< "not refused" <<RESET<< std::endl;
+        }
+        catch (const std::logic_error& e)
+        {
+            std::cout <<BLUE<< "write through a reader: " <<RESET<< e.what() << std::endl;
+        }
+        size_t capacity = ft_writer.capacity();
+        ft_writer.shrink_to_fit();
+        std::cout <<BLUE<< "shrink skipped while a reader is open: " <<RESET<< (ft_writer.capacity() == capacity) << " | ";
+        std::cout <<BLUE<< "reader still reads: " <<RESET<< (reader[999] == 999) << " | ";
+        ft_reader.close();
+        ft_writer.shrink_to_fit();
+        std::cout <<BLUE<< "shrunk once the reader closed: " <<RESET<< (ft_writer.capacity() < capacity) << std::endl;
+    }
+    unlink(path);
+    std::cout << GREEN << "///TEST RESTART (8M entries of 16 bytes)///" << RESET << std::endl;
+    if (true)
+    {
+        size_t      n = 8 << 20;
+        clock_t     time_rebuild;
+        clock_t     time_create;
+        clock_t     time_open;
+        double      total = 0;
+        double      mapped_total = 0;
+
+        time_rebuild = clock();
+        {
+            ft::vector<entry>   ft_vector;
+
+            for (size_t i = 0; i != n; i++)
+                ft_vector.push_back(make_entry(i));
+            total = ft_vector[n / 2].weight + ft_vector[n - 1].weight;
+        }
+        time_rebuild = clock() - time_rebuild;
+        time_create = clock();
+        {
+            ft::mapped_vector<entry>    ft_mapped(path);
+
+            for (size_t i = 0; i != n; i++)
+                ft_mapped.push_back(make_entry(i));
+        }
+        time_create = clock() - time_create;
+        time_open = clock();
+        {
+            const ft::mapped_vector<entry>  ft_mapped(path, ft::mapped_vector<entry>::read_only);
+
+            mapped_total = ft_mapped[n / 2].weight + ft_mapped[n - 1].weight;
+        }
+        time_open = clock() - time_open;
+        std::cout <<BLUE<< "same lookups: " <<RESET<< (total == mapped_total) << " | ";
+        std::cout <<BLUE<< "rebuild ft::vector time: " <<RESET<< time_rebuild << " | ";
+        std::cout <<BLUE<< "first build into file time: " <<RESET<< time_create << " | ";
+        std::cout <<BLUE<< "reopen + 2 lookups time: " <<RESET<< time_open << std::endl;
+    }
+    unlink(path);
+}
@@ -0,0 +1,178 @@
+#include "parallel.hpp"
+#include "vector.hpp"
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <iostream>
+#include <time.h>
+#include <sys/time.h>
+
+#define RED   "\x1b[31m"
+#define GREEN   "\x1b[32m"
+#define YELLOW  "\x1b[33m"
+#define BLUE    "\x1b[34m"
+#define MAGENTA "\x1b[35m"
+#define CYAN    "\x1b[36m"
+#define RESET   "\x1b[0m"
+
+struct square
+{
+    long operator()(long x) const { return (x * x % 1000003); }
+};
+
+struct add_one
+{
+    void operator()(long& x) const { x += 1; }
+};
+
+struct is_multiple
+{
+    long n;
+    bool operator()(long x) const { return (x % n == 0); }
+};
+
+struct is_value
+{
+    long v;
+    bool operator()(long x) const { return (x == v); }
+};
+
+static long wall_usec(const struct timeval& start, const struct timeval& end)
+{
+    return ((end.tv_sec - start.tv_sec) * 1000000 + end.tv_usec - start.tv_usec);
+}
+
+static void print_check(const char *name, bool same)
+{
+    std::cout <<BLUE<< name << ": " <<RESET;
+    if (same)
+        std::cout << "ok" << std::endl;
+    else
+        std::cout <<RED<< "KO" <<RESET<< std::endl;
+}
+
+static void print_time(size_t threads, long usec, long base)
+{
+    std::cout <<MAGENTA<< "threads " << threads << ": " <<RESET<< usec << " us";
+    if (usec != 0)
+        std::cout << " | speedup: " << (double)base / usec;
+    std::cout << std::endl;
+}
+
+int main()
+{
+    std::cout << GREEN << "*\n*\n*\n*\n**********TEST PARALLEL**********\n*\n*\n*\n*" << RESET << std::endl;
+    std::cout <<BLUE<< "hardware threads: " <<RESET<< ft::parallel::thread_pool::hardware_threads() << std::endl;
+    std::cout << GREEN << "///TEST RESULTS AGAINST SERIAL STD ALGORITHMS///" << RESET << std::endl;
+    if (true)
+    {
+        ft::parallel::thread_pool   pool(4);
+        size_t                      sizes[] = { 0, 1, 7, 1000, 100003 };
+
+        for (size_t s = 0; s != sizeof(sizes) / sizeof(*sizes); s++)
+        {
+            size_t              n = sizes[s];
+            ft::vector<long>    ft_vector(n);
+            std::vector<long>   std_vector(n);
+            is_multiple         pred;
+            is_value            pred_value;
+
+            for (size_t i = 0; i != n; i++)
+            {
+                ft_vector[i] = (long)(i * 7919 % 10007);
+                std_vector[i] = ft_vector[i];
+            }
+            pred.n = 13;
+            pred_value.v = (n > 1 ? ft_vector[n - 2] : -1);
+            std::cout <<CYAN<< "size " << n <<RESET<< std::endl;
+
+            ft::parallel::for_each(pool, ft_vector.begin(), ft_vector.end(), add_one(), 100);
+            std::for_each(std_vector.begin(), std_vector.end(), add_one());
+            print_check("for_each", std::equal(std_vector.begin(), std_vector.end(), ft_vector.begin()));
+
+            ft::vector<long>    ft_out(n);
+            std::vector<long>   std_out(n);
+            ft::parallel::transform(pool, ft_vector.begin(), ft_vector.end(), ft_out.begin(), square(), 100);
+            std::transform(std_vector.begin(), std_vector.end(), std_out.begin(), square());
+            print_check("transform", std::equal(std_out.begin(), std_out.end(), ft_out.begin()));
+
+            long ft_sum = ft::parallel::reduce(pool, ft_vector.begin(), ft_vector.end(), 5L, ft::plus<long>(), 100);
+            long std_sum = std::accumulate(std_vector.begin(), std_vector.end(), 5L);
+            print_check("reduce", ft_sum == std_sum);
+
+            ft::parallel::inclusive_scan(pool, ft_vector.begin(), ft_vector.end(), ft_out.begin(), ft::plus<long>(), 100);
+            std::partial_sum(std_vector.begin(), std_vector.end(), std_out.begin());
+            print_check("inclusive_scan", std::equal(std_out.begin(), std_out.end(), ft_out.begin()));
+
+            ft::vector<long>::iterator ft_it = ft::parallel::find_if(pool, ft_vector.begin(), ft_vector.end(), pred_value, 100);
+            std::vector<long>::iterator std_it = std::find_if(std_vector.begin(), std_vector.end(), pred_value);
+            print_check("find_if", ft_it - ft_vector.begin() == std_it - std_vector.begin());
+
+            long ft_count = ft::parallel::count_if(pool, ft_vector.begin(), ft_vector.end(), pred, 100);
+            long std_count = std::count_if(std_vector.begin(), std_vector.end(), pred);
+            print_check("count_if", ft_count == std_count);
+        }
+    }
+    std::cout << GREEN << "///TEST SCALING (20M longs, grain " << ft::parallel::default_grain << ")///" << RESET << std::endl;
+    if (true)
+    {
+        size_t              n = 20000000;
+        ft::vector<long>    data(n);
+        ft::vector<long>    out(n);
+        size_t              counts[] = { 1, 2, 4, 8 };
+        long                base[4] = { 0, 0, 0, 0 };
+        struct timeval      start;
+        struct timeval      end;
+        clock_t             time_std;
+        is_multiple         pred;
+        is_value            pred_value;
+
+        for (size_t i = 0; i != n; i++)
+            data[i] = (long)(i % 1000);
+        pred.n = 7;
+        pred_value.v = -1;
+        time_std = clock();
+        std::transform(data.begin(), data.end(), out.begin(), square());
+        long serial_sum = std::accumulate(data.begin(), data.end(), 0L);
+        time_std = clock() - time_std;
+        std::cout <<BLUE<< "serial std transform + accumulate time: " <<RESET<< time_std << std::endl;
+        for (size_t c = 0; c != sizeof(counts) / sizeof(*counts); c++)
+        {
+            ft::parallel::thread_pool   pool(counts[c]);
+            long                        times[4];
+
+            gettimeofday(&start, NULL);
+            ft::parallel::transform(pool, data.begin(), data.end(), out.begin(), square());
+            gettimeofday(&end, NULL);
+            times[0] = wall_usec(start, end);
+            gettimeofday(&start, NULL);
+            long sum = ft::parallel::reduce(pool, data.begin(), data.end(), 0L);
+            gettimeofday(&end, NULL);
+            times[1] = wall_usec(start, end);
+            gettimeofday(&start, NULL);
+            ft::parallel::inclusive_scan(pool, data.begin(), data.end(), out.begin());
+            gettimeofday(&end, NULL);
+            times[2] = wall_usec(start, end);
+            gettimeofday(&start, NULL);
+            long hits = ft::parallel::count_if(pool, data.begin(), data.end(), pred);
+            bool none = ft::parallel::find_if(pool, data.begin(), data.end(), pred_value) == data.end();
+            gettimeofday(&end, NULL);
+            times[3] = wall_usec(start, end);
+            if (c == 0)
+                for (size_t k = 0; k != 4; k++)
+                    base[k] = times[k];
+            std::cout <<CYAN<< "pool of " << counts[c] <<RESET<< " | ";
+            std::cout <<BLUE<< "sum ok: " <<RESET<< (sum == serial_sum) << " | ";
+            std::cout <<BLUE<< "scan ok: " <<RESET<< (out[n - 1] == serial_sum) << " | ";
+            std::cout <<BLUE<< "count/find: " <<RESET<< hits << " " << none << std::endl;
+            std::cout <<YELLOW<< "transform " <<RESET;
+            print_time(counts[c], times[0], base[0]);
+            std::cout <<YELLOW<< "reduce " <<RESET;
+            print_time(counts[c], times[1], base[1]);
+            std::cout <<YELLOW<< "inclusive_scan " <<RESET;
+            print_time(counts[c], times[2], base[2]);
+            std::cout <<YELLOW<< "count_if + find_if " <<RESET;
+            print_time(counts[c], times[3], base[3]);
+        }
+    }
+}
@@ -0,0 +1,215 @@
+#include "small_vector.hpp"
+#include "stack.hpp"
+#include <vector>
+#include <stack>
+#include <string>
+#include <memory>
+#include <iostream>
+#include <time.h>
+
+#define RED   "\x1b[31m"
+#define GREEN   "\x1b[32m"
+#define YELLOW  "\x1b[33m"
+#define BLUE    "\x1b[34m"
+#define MAGENTA "\x1b[35m"
+#define CYAN    "\x1b[36m"
+#define RESET   "\x1b[0m"
+
+static size_t g_allocations = 0;
+
+/* std::allocator that counts calls to allocate */
+template <class T>
+struct counting_allocator : public std::allocator<T>
+{
+    template <class U>
+    struct rebind { typedef counting_allocator<U> other; };
+
+    counting_allocator() {}
+    counting_allocator(const counting_allocator& x) : std::allocator<T>(x) {}
+    template <class U>
+    counting_allocator(const counting_allocator<U>&) {}
+
+    T* allocate(size_t n, const void* = 0)
+    {
+        g_allocations++;
+        return (std::allocator<T>::allocate(n));
+    }
+};
+
+/* Over-aligned on purpose: inline storage must still start on a 64-byte boundary. */
+struct wide
+{
+    int value;
+} __attribute__((aligned(64)));
+
+/* One "request": build a collection of `count` ints and read it back. */
+template <class Vec>
+void bench_requests(const char *name, int requests)
+{
+    long        sum = 0;
+    clock_t     time;
+
+    g_allocations = 0;
+    time = clock();
+    for (int i = 0; i != requests; i++)
+    {
+        Vec v;
+        int count = i % 8;
+        for (int j = 0; j != count; j++)
+            v.push_back(j);
+        for (size_t j = 0; j != v.size(); j++)
+            sum += v[j];
+    }
+    time = clock() - time;
+    std::cout <<CYAN<< name <<RESET<< std::endl;
+    std::cout <<BLUE<< "sum: " <<RESET<< sum << " | ";
+    std::cout <<BLUE<< "allocations: " <<RESET<< g_allocations << " | ";
+    std::cout <<BLUE<< "time: " <<RESET<< time << std::endl;
+}
+
+template <class Small, class Std>
+void print_small_vector(const Small& ft_vector, const Std& std_vector)
+{
+    for (size_t i = 0; i != ft_vector.size() || i != std_vector.size(); i++)
+    {
+        if (i < ft_vector.size() && i < std_vector.size() && ft_vector[i] == std_vector[i])
+            std::cout <<MAGENTA<< "ft_small_vector: " <<RESET<< ft_vector[i] << " | ";
+        else if (i < ft_vector.size())
+            std::cout <<MAGENTA<< "ft_small_vector: " <<RED<< ft_vector[i] <<RESET<< " | ";
+        else
+            std::cout <<MAGENTA<< "ft_small_vector: " <<RED<< "NULL" <<RESET<< " | ";
+        if (i < std_vector.size())
+            std::cout <<MAGENTA<< "std_vector: " <<RESET<< std_vector[i] << std::endl;
+        else
+            std::cout <<MAGENTA<< "std_vector: " <<RED<< "NULL" <<RESET<< std::endl;
+    }
+    if (ft_vector.size() == std_vector.size())
+        std::cout <<BLUE<< "ft_small_vector size: " <<RESET<< ft_vector.size() << " | ";
+    else
+        std::cout <<BLUE<< "ft_small_vector size: " <<RED<< ft_vector.size() <<RESET<< " | ";
+    std::cout <<BLUE<< "std_vector size: " <<RESET<< std_vector.size() << " | ";
+    std::cout <<BLUE<< "inline: " <<RESET<< ft_vector.is_inline() << std::endl;
+}
+
+int main()
+{
+    std::cout << GREEN << "*\n*\n*\n*\n**********TEST SMALL_VECTOR**********\n*\n*\n*\n*" << RESET << std::endl;
+    std::cout << GREEN << "///TEST INLINE & SPILL///" << RESET << std::endl;
+    if (true)
+    {
+        ft::small_vector<std::string, 4>   ft_vector1;
+        std::vector<std::string>           std_vector1;
+
+        for (int i = 0; i != 3; i++)
+        {
+            ft_vector1.push_back(std::string(i + 1, 'a' + i));
+            std_vector1.push_back(std::string(i + 1, 'a' + i));
+        }
+        print_small_vector(ft_vector1, std_vector1);
+        ft_vector1.insert(ft_vector1.begin() + 1, 3, std::string(20, 'x'));
+        std_vector1.insert(std_vector1.begin() + 1, 3, std::string(20, 'x'));
+        print_small_vector(ft_vector1, std_vector1);
+        ft_vector1.erase(ft_vector1.begin(), ft_vector1.begin() + 2);
+        std_vector1.erase(std_vector1.begin(), std_vector1.begin() + 2);
+        ft_vector1.erase(ft_vector1.begin() + 1);
+        std_vector1.erase(std_vector1.begin() + 1);
+        print_small_vector(ft_vector1, std_vector1);
+        ft_vector1.shrink_to_fit();
+        print_small_vector(ft_vector1, std_vector1);
+
+        ft::small_vector<std::string, 4>   ft_vector2(2, "inline");
+        std::vector<std::string>           std_vector2(2, "inline");
+        ft_vector1.swap(ft_vector2);
+        std_vector1.swap(std_vector2);
+        print_small_vector(ft_vector1, std_vector1);
+        print_small_vector(ft_vector2, std_vector2);
+        ft::small_vector<std::string, 4>   ft_vector3(ft_vector2);
+        std::cout <<BLUE<< "ft_small_vector copy ==: " <<RESET<< (ft_vector3 == ft_vector2) << " | ";
+        std::cout <<BLUE<< "ft_small_vector <: " <<RESET<< (ft_vector1 < ft_vector2) << " | ";
+        std::cout <<BLUE<< "std_vector <: " <<RESET<< (std_vector1 < std_vector2) << std::endl;
+    }
+    std::cout << GREEN << "///TEST SWAP & ALIGNMENT///" << RESET << std::endl;
+    if (true)
+    {
+        typedef ft::small_vector<std::string, 4, counting_allocator<std::string> >  counted;
+        counted                     ft_vector1;
+        counted                     ft_vector2;
+        std::vector<std::string>    std_vector1;
+        std::vector<std::string>    std_vector2;
+
+        for (int i = 0; i != 3; i++)
+        {
+            ft_vector1.push_back(std::string(30, 'a' + i));
+            std_vector1.push_back(std::string(30, 'a' + i));
+        }
+        ft_vector2.push_back("one");
+        std_vector2.push_back("one");
+        size_t before = g_allocations;
+        ft_vector1.swap(ft_vector2);
+        std_vector1.swap(std_vector2);
+        size_t swap_allocations = g_allocations - before;
+        print_small_vector(ft_vector1, std_vector1);
+        print_small_vector(ft_vector2, std_vector2);
+        for (int i = 0; i != 6; i++)
+        {
+            ft_vector1.push_back(std::string(i + 1, 'h'));
+            std_vector1.push_back(std::string(i + 1, 'h'));
+        }
+        before = g_allocations;
+        ft_vector1.swap(ft_vector2);
+        std_vector1.swap(std_vector2);
+        swap_allocations += g_allocations - before;
+        print_small_vector(ft_vector1, std_vector1);
+        print_small_vector(ft_vector2, std_vector2);
+        std::cout <<BLUE<< "allocations during swaps: " <<RESET<< swap_allocations << std::endl;
+
+        ft::small_vector<wide, 3>  ft_wide;
+        wide                        w = { 7 };
+        ft_wide.push_back(w);
+        std::cout <<BLUE<< "over-aligned inline element on a 64-byte boundary: " <<RESET
+                  << ((size_t)&ft_wide[0] % 64 == 0) << std::endl;
+#ifdef FT_CXX11
+        ft::small_vector<std::unique_ptr<int>, 2>  ft_owners1;
+        ft::small_vector<std::unique_ptr<int>, 2>  ft_owners2;
+        ft_owners1.emplace_back(new int(1));
+        ft_owners2.emplace_back(new int(2));
+        ft_owners2.emplace_back(new int(3));
+        ft_owners2.emplace_back(new int(4));
+        ft_owners1.swap(ft_owners2);
+        ft_owners1.swap(ft_owners2);
+        std::cout <<BLUE<< "move-only swap: " <<RESET << *ft_owners1[0] << " " << *ft_owners2[0]
+                  << " " << *ft_owners2[2] << " | " <<BLUE<< "inline: " <<RESET<< ft_owners1.is_inline() << std::endl;
+        std::cout <<BLUE<< "nothrow movable (int): " <<RESET<< std::is_nothrow_move_constructible<ft::small_vector<int, 4> >::value << " | ";
+        std::cout <<BLUE<< "nothrow movable (unique_ptr): " <<RESET
+                  << std::is_nothrow_move_constructible<ft::small_vector<std::unique_ptr<int>, 2> >::value << std::endl;
+#endif
+    }
+    std::cout << GREEN << "///TEST STACK ON SMALL_VECTOR///" << RESET << std::endl;
+    if (true)
+    {
+        ft::stack<int, ft::small_vector<int, 8> >  ft_stack;
+        std::stack<int>                            std_stack;
+
+        for (int i = 0; i != 12; i++)
+        {
+            ft_stack.push(i * i);
+            std_stack.push(i * i);
+        }
+        for (int i = 0; i != 5; i++)
+        {
+            ft_stack.pop();
+            std_stack.pop();
+        }
+        std::cout <<BLUE<< "ft_stack top: " <<RESET<< ft_stack.top() << " | ";
+        std::cout <<BLUE<< "std_stack top: " <<RESET<< std_stack.top() << std::endl;
+        std::cout <<BLUE<< "ft_stack size: " <<RESET<< ft_stack.size() << " | ";
+        std::cout <<BLUE<< "std_stack size: " <<RESET<< std_stack.size() << std::endl;
+    }
+    std::cout << GREEN << "///TEST ALLOCATION COUNT (1M requests of 0-7 ints)///" << RESET << std::endl;
+    if (true)
+    {
+        bench_requests<ft::vector<int, counting_allocator<int> > >("ft::vector", 1000000);
+        bench_requests<ft::small_vector<int, 8, counting_allocator<int> > >("ft::small_vector<int, 8>", 1000000);
+        bench_requests<std::vector<int, counting_allocator<int> > >("std::vector", 1000000);
+    }
+}
@@ -0,0 +1,143 @@
+#include "soa_vector.hpp"
+#include "vector.hpp"
+#include <vector>
+#include <string>
+#include <iostream>
+#include <time.h>
+
+#define RED   "\x1b[31m"
+#define GREEN   "\x1b[32m"
+#define YELLOW  "\x1b[33m"
+#define BLUE    "\x1b[34m"
+#define MAGENTA "\x1b[35m"
+#define CYAN    "\x1b[36m"
+#define RESET   "\x1b[0m"
+
+struct pad40
+{
+    char    bytes[40];
+};
+
+/* 64-byte record of which the scans below read one or two fields */
+struct record
+{
+    double  price;
+    int     qty;
+    long    id;
+    pad40   name;
+};
+
+int main()
+{
+    std::cout << GREEN << "*\n*\n*\n*\n**********TEST SOA_VECTOR**********\n*\n*\n*\n*" << RESET << std::endl;
+    std::cout << GREEN << "///TEST ROWS & COLUMNS///" << RESET << std::endl;
+    if (true)
+    {
+        ft::soa_vector<int, std::string, double>    ft_soa;
+        std::vector<int>                            std_ids;
+        std::vector<std::string>                    std_names;
+
+        for (int i = 0; i != 6; i++)
+        {
+            ft_soa.push_back(i, std::string(i + 1, 'a' + i), i * 0.5);
+            std_ids.push_back(i);
+            std_names.push_back(std::string(i + 1, 'a' + i));
+        }
+        ft_soa[2] = ft::soa_row<int, std::string, double>(20, "row", 10.0);
+        std_ids[2] = 20;
+        std_names[2] = "row";
+        ft_soa[4].get<1>() = "proxy";
+        std_names[4] = "proxy";
+        ft::soa_span<int>           ids = ft_soa.column<0>();
+        ft::soa_span<std::string>   names = ft_soa.column<1>();
+        for (size_t i = 0; i != ft_soa.size(); i++)
+        {
+            if (ids[i] == std_ids[i] && names[i] == std_names[i])
+                std::cout <<MAGENTA<< "ft_soa: " <<RESET<< ids[i] << " " << names[i] << " | ";
+            else
+                std::cout <<MAGENTA<< "ft_soa: " <<RED<< ids[i] << " " << names[i] <<RESET<< " | ";
+            std::cout <<MAGENTA<< "std_vectors: " <<RESET<< std_ids[i] << " " << std_names[i] << std::endl;
+        }
+        ft::soa_vector<int, std::string, double>    ft_copy(ft_soa);
+        ft_copy.pop_back();
+        ft_copy.resize(8, ft::soa_row<int, std::string, double>(-1, "fill", 0.0));
+        ft::soa_row<int, std::string, double>       last = ft_copy[7];
+        std::cout <<BLUE<< "copy size: " <<RESET<< ft_copy.size() << " | ";
+        std::cout <<BLUE<< "row 5: " <<RESET<< ft_copy[5].get<1>() << " | ";
+        std::cout <<BLUE<< "row 7: " <<RESET<< last.f0 << " " << last.f1 << " | ";
+        std::cout <<BLUE<< "column 2 sum: " <<RESET;
+        double sum = 0;
+        for (double *it = ft_soa.column<2>().begin(); it != ft_soa.column<2>().end(); it++)
+            sum += *it;
+        std::cout << sum << std::endl;
+    }
+    std::cout << GREEN << "///TEST FIELD SCANS (4M rows of 64 bytes, 10 passes)///" << RESET << std::endl;
+    if (true)
+    {
+        size_t                                      n = 4000000;
+        ft::vector<record>                          ft_rows;
+        ft::soa_vector<double, int, long, pad40>    ft_soa;
+        record                                      r;
+        clock_t                                     time_rows;
+        clock_t                                     time_soa;
+        double                                      sum_rows = 0;
+        double                                      sum_soa = 0;
+
+        ft_rows.reserve(n);
+        ft_soa.reserve(n);
+        for (size_t i = 0; i != n; i++)
+        {
+            r.price = (double)(i % 1000) * 0.25;
+            r.qty = (int)(i % 7);
+            r.id = (long)i;
+            r.name.bytes[0] = 'x';
+            ft_rows.push_back(r);
+            ft_soa.push_back(r.price, r.qty, r.id, r.name);
+        }
+
+        time_rows = clock();
+        for (int pass = 0; pass != 10; pass++)
+            for (size_t i = 0; i != n; i++)
+                sum_rows += ft_rows[i].price;
+        time_rows = clock() - time_rows;
+        time_soa = clock();
+        for (int pass = 0; pass != 10; pass++)
+        {
+            ft::soa_span<double> price = ft_soa.column<0>();
+            for (size_t i = 0; i != price.size(); i++)
+                sum_soa += price[i];
+        }
+        time_soa = clock() - time_soa;
+        std::cout <<CYAN<< "sum(price)" <<RESET<< std::endl;
+        std::cout <<BLUE<< "same result: " <<RESET<< (sum_rows == sum_soa) << " | ";
+        std::cout <<BLUE<< "ft::vector<record> time: " <<RESET<< time_rows << " | ";
+        std::cout <<BLUE<< "ft::soa_vector time: " <<RESET<< time_soa << " | ";
+        if (time_soa != 0)
+            std::cout <<BLUE<< "speedup: " <<RESET<< (double)time_rows / time_soa;
+        std::cout << std::endl;
+
+        sum_rows = 0;
+        sum_soa = 0;
+        time_rows = clock();
+        for (int pass = 0; pass != 10; pass++)
+            for (size_t i = 0; i != n; i++)
+                sum_rows += ft_rows[i].price * ft_rows[i].qty;
+        time_rows = clock() - time_rows;
+        time_soa = clock();
+        for (int pass = 0; pass != 10; pass++)
+        {
+            ft::soa_span<double>    price = ft_soa.column<0>();
+            ft::soa_span<int>       qty = ft_soa.column<1>();
+            for (size_t i = 0; i != price.size(); i++)
+                sum_soa += price[i] * qty[i];
+        }
+        time_soa = clock() - time_soa;
+        std::cout <<CYAN<< "sum(price * qty)" <<RESET<< std::endl;
+        std::cout <<BLUE<< "same result: " <<RESET<< (sum_rows == sum_soa) << " | ";
+        std::cout <<BLUE<< "ft::vector<record> time: " <<RESET<< time_rows << " | ";
+        std::cout <<BLUE<< "ft::soa_vector time: " <<RESET<< time_soa << " | ";
+        if (time_soa != 0)
+            std::cout <<BLUE<< "speedup: " <<RESET<< (double)time_rows / time_soa;
+        std::cout << std::endl;
+    }
+}
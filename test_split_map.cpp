@@ -0,0 +1,338 @@
+#include "split_map.hpp"
+#include "map.hpp"
+#include "aligned_allocator.hpp"
+#include <map>
+#include <vector>
+#include <iostream>
+#include <string>
+#include <cstdlib>
+#include <time.h>
+#include <pthread.h>
+
+#define RED   "\x1b[31m"
+#define GREEN   "\x1b[32m"
+#define YELLOW  "\x1b[33m"
+#define BLUE    "\x1b[34m"
+#define MAGENTA "\x1b[35m"
+#define CYAN    "\x1b[36m"
+#define RESET   "\x1b[0m"
+
+template <size_t N>
+struct payload
+{
+    char data[N];
+
+    payload() { data[0] = 0; }
+    explicit payload(int v) { data[0] = (char)v; }
+};
+
+/* Copying throws once armed, to check that a failed insert leaves nothing behind. */
+struct fragile
+{
+    static bool armed;
+    int         v;
+
+    fragile() : v(0) {}
+    explicit fragile(int x) : v(x) {}
+    fragile(const fragile& x) : v(x.v)
+    {
+        if (armed)
+            throw std::runtime_error("fragile copy");
+    }
+    fragile& operator=(const fragile& x) { v = x.v; return (*this); }
+};
+
+bool fragile::armed = false;
+
+/* A large value that counts its copies, to see what erase does to the store. */
+struct counted
+{
+    static long copies;
+    char        data[256];
+    int         v;
+
+    counted() : v(0) {}
+    explicit counted(int x) : v(x) {}
+    counted(const counted& x) : v(x.v) { copies++; }
+    counted& operator=(const counted& x) { v = x.v; copies++; return (*this); }
+#ifdef FT_CXX11
+    counted(counted&& x) noexcept : v(x.v) {}
+    counted& operator=(counted&& x) noexcept { v = x.v; return (*this); }
+#endif
+};
+
+long counted::copies = 0;
+
+bool run_on_small_stack(void *(*fn)(void *), void *arg)
+{
+    pthread_attr_t  attr;
+    pthread_t       id;
+    void            *ok;
+
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, 128 * 1024);
+    if (pthread_create(&id, &attr, fn, arg) != 0)
+        return (false);
+    pthread_attr_destroy(&attr);
+    pthread_join(id, &ok);
+    return (ok != NULL);
+}
+
+/* Fills a split_map in ascending order, so the tree is a single right spine, and frees it. */
+void *destroy_chain(void *arg)
+{
+    int                     n = *static_cast<int *>(arg);
+    ft::split_map<int,int>  chain;
+
+    for (int i = 0; i != n; i++)
+        chain.insert(ft::make_pair(i, i));
+    chain.clear();
+    for (int i = 0; i != n; i++)
+        chain.insert(ft::make_pair(i, i));
+    return (chain.size() == (size_t)n ? arg : NULL);
+}
+
+template <size_t N>
+void bench_value_size(const std::vector<int>& keys, const std::vector<int>& lookups)
+{
+    ft::map<int, payload<N> >       ft_map;
+    ft::split_map<int, payload<N> > ft_split;
+    std::map<int, payload<N> >      std_map;
+    long                            map_sum = 0;
+    long                            split_sum = 0;
+    long                            std_sum = 0;
+    clock_t                         time_map;
+    clock_t                         time_split;
+    clock_t                         time_std;
+
+    for (size_t i = 0; i != keys.size(); i++)
+    {
+        ft_map.insert(ft::make_pair(keys[i], payload<N>(keys[i])));
+        ft_split.insert(ft::make_pair(keys[i], payload<N>(keys[i])));
+        std_map.insert(std::make_pair(keys[i], payload<N>(keys[i])));
+    }
+    time_map = clock();
+    for (size_t i = 0; i != lookups.size(); i++)
+        map_sum += ft_map.count(lookups[i]);
+    time_map = clock() - time_map;
+    time_split = clock();
+    for (size_t i = 0; i != lookups.size(); i++)
+        split_sum += ft_split.count(lookups[i]);
+    time_split = clock() - time_split;
+    time_std = clock();
+    for (size_t i = 0; i != lookups.size(); i++)
+        std_sum += std_map.count(lookups[i]);
+    time_std = clock() - time_std;
+    std::cout <<CYAN<< "value size " << N <<RESET<< std::endl;
+    if (map_sum == split_sum && split_sum == std_sum)
+        std::cout <<BLUE<< "hits: " <<RESET<< split_sum << std::endl;
+    else
+        std::cout <<BLUE<< "hits: " <<RED<< map_sum << " / " << split_sum << " / " << std_sum <<RESET<< std::endl;
+    std::cout <<BLUE<< "ft_map time: " <<RESET<< time_map << " | ";
+    std::cout <<BLUE<< "ft_split_map time: " <<RESET<< time_split << " | ";
+    std::cout <<BLUE<< "std_map time: " <<RESET<< time_std << std::endl;
+}
+
+void print_split_map_int(ft::split_map<int,int>& ft_map, std::map<int,int>& std_map)
+{
+    ft::split_map<int,int>::iterator ft_it = ft_map.begin();
+    std::map<int,int>::iterator std_it = std_map.begin();
+    while (true)
+    {
+        if (ft_it == ft_map.end() && std_it == std_map.end())
+            break ;
+        if (ft_it != ft_map.end())
+        {
+            if (std_it != std_map.end() && ft_it->first == std_it->first && ft_it->second == std_it->second)
+                std::cout <<MAGENTA<< "ft_split_map: " <<RESET<< ft_it->first <<" -> "<< ft_it->second << " | ";
+            else
+                std::cout <<MAGENTA<< "ft_split_map: " <<RED<< ft_it->first <<" -> "<< ft_it->second <<RESET<< " | ";
+            ft_it++;
+        }
+        else
+            std::cout <<MAGENTA<< "ft_split_map: " <<RED<< "NULL" <<RESET;
+        if (std_it != std_map.end())
+        {
+            std::cout <<MAGENTA<< "std_map: " <<RESET<< std_it->first <<" -> "<< std_it->second << std::endl;
+            std_it++;
+        }
+        else
+            std::cout <<MAGENTA<< "std_map: " << RED << "NULL" << RESET << std::endl;
+    }
+    if (ft_map.size() == std_map.size())
+        std::cout <<BLUE<< "ft_split_map size: " <<RESET<< ft_map.size() << " | ";
+    else
+        std::cout <<BLUE<< "ft_split_map size: " <<RED<< ft_map.size() <<RESET<< " | ";
+    std::cout <<BLUE<< "std_map size: " <<RESET<< std_map.size() << std::endl;
+}
+
+int main()
+{
+    std::cout << GREEN << "*\n*\n*\n*\n**********TEST SPLIT_MAP**********\n*\n*\n*\n*" << RESET << std::endl;
+    std::cout << GREEN << "///TEST INSERT & ERASE///" << RESET << std::endl;
+    if (true)
+    {
+        ft::split_map<int,int> ft_map1;
+        std::map<int,int> std_map1;
+        for (int i = 0; i != 20; i++)
+        {
+            ft_map1.insert(ft::make_pair((i * 7) % 20, i));
+            std_map1.insert(std::make_pair((i * 7) % 20, i));
+        }
+        print_split_map_int(ft_map1, std_map1);
+        for (int i = 0; i < 20; i += 3)
+        {
+            ft_map1.erase(i);
+            std_map1.erase(i);
+        }
+        ft_map1.erase(ft_map1.begin());
+        std_map1.erase(std_map1.begin());
+        ft_map1[42] = 4242;
+        std_map1[42] = 4242;
+        print_split_map_int(ft_map1, std_map1);
+        std::cout <<BLUE<< "ft_split_map rbegin: " <<RESET<< ft_map1.rbegin()->first << " | ";
+        std::cout <<BLUE<< "std_map rbegin: " <<RESET<< std_map1.rbegin()->first << std::endl;
+        std::cout <<BLUE<< "ft_split_map count(7): " <<RESET<< ft_map1.count(7) << " | ";
+        std::cout <<BLUE<< "std_map count(7): " <<RESET<< std_map1.count(7) << std::endl;
+        ft::split_map<int,int> ft_map2(ft_map1);
+        std::cout <<BLUE<< "ft_split_map copy ==: " <<RESET<< (ft_map1 == ft_map2) << std::endl;
+    }
+    std::cout << GREEN << "///TEST BOUNDS, RANGE ERASE & HINTED INSERT///" << RESET << std::endl;
+    if (true)
+    {
+        ft::split_map<int,int> ft_map1;
+        std::map<int,int> std_map1;
+        for (int i = 0; i != 30; i += 2)
+        {
+            ft_map1.insert(ft_map1.end(), ft::make_pair(i, i * 10));
+            std_map1.insert(std_map1.end(), std::make_pair(i, i * 10));
+        }
+        ft_map1.insert(ft_map1.find(10), ft::make_pair(9, 90));
+        std_map1.insert(std_map1.find(10), std::make_pair(9, 90));
+        ft_map1.insert(ft_map1.begin(), ft::make_pair(25, 250));
+        std_map1.insert(std_map1.begin(), std::make_pair(25, 250));
+        std::cout <<BLUE<< "ft_split_map upper_bound(9): " <<RESET<< ft_map1.upper_bound(9)->first << " | ";
+        std::cout <<BLUE<< "std_map upper_bound(9): " <<RESET<< std_map1.upper_bound(9)->first << std::endl;
+        std::cout <<BLUE<< "ft_split_map equal_range(11): " <<RESET<< ft_map1.equal_range(11).first->first
+                  << " " << ft_map1.equal_range(11).second->first << " | ";
+        std::cout <<BLUE<< "std_map equal_range(11): " <<RESET<< std_map1.equal_range(11).first->first
+                  << " " << std_map1.equal_range(11).second->first << std::endl;
+        std::cout <<BLUE<< "ft_split_map upper_bound(28) is end: " <<RESET<< (ft_map1.upper_bound(28) == ft_map1.end()) << std::endl;
+        ft_map1.erase(ft_map1.lower_bound(6), ft_map1.upper_bound(20));
+        std_map1.erase(std_map1.lower_bound(6), std_map1.upper_bound(20));
+        print_split_map_int(ft_map1, std_map1);
+
+        ft::split_map<int,fragile> ft_fragile;
+        ft::pair<const int,fragile> two(2, fragile(2));
+        ft_fragile.insert(ft::make_pair(1, fragile(1)));
+        fragile::armed = true;
+        try
+        {
+            ft_fragile.insert(two);
+        }
+        catch (const std::runtime_error& e)
+        {
+            fragile::armed = false;
+            std::cout <<BLUE<< "insert that throws: " <<RESET<< e.what() << " | ";
+        }
+        fragile::armed = false;
+        std::cout <<BLUE<< "size after: " <<RESET<< ft_fragile.size() << " | ";
+        std::cout <<BLUE<< "values after: " <<RESET<< ft_fragile.values().size() << " | ";
+        std::cout <<BLUE<< "count(2): " <<RESET<< ft_fragile.count(2) << std::endl;
+    }
+    std::cout << GREEN << "///TEST ERASE FILLS THE HOLE & CHAIN TEARDOWN///" << RESET << std::endl;
+    if (true)
+    {
+        ft::split_map<int, counted> ft_map3;
+        std::map<int, int>          std_map3;
+        bool                        same = true;
+        int                         chain = 10000;
+
+        for (int i = 0; i != 100; i++)
+        {
+            ft_map3.insert(ft::make_pair((i * 37) % 100, counted(i)));
+            std_map3.insert(std::make_pair((i * 37) % 100, i));
+        }
+        counted::copies = 0;
+        for (int i = 0; i < 100; i += 3)
+        {
+            ft_map3.erase(i);
+            std_map3.erase(i);
+        }
+        std::map<int, int>::iterator std_it = std_map3.begin();
+        for (ft::split_map<int, counted>::iterator it = ft_map3.begin(); it != ft_map3.end(); ++it, ++std_it)
+            same &= it->first == std_it->first && it->second.v == std_it->second;
+        std::cout <<BLUE<< "same as std::map after erase: " <<RESET<< (same && ft_map3.size() == std_map3.size()) << " | ";
+#ifdef FT_CXX11
+        std::cout <<BLUE<< "values copied by erase: " <<RESET<< counted::copies << " | ";
+#endif
+        std::cout <<BLUE<< "ft_split_map teardown on a 128 KB stack: " <<RESET<< run_on_small_stack(&destroy_chain, &chain) << std::endl;
+    }
+    std::cout << GREEN << "///TEST VALUE SIZE BENCHMARK///" << RESET << std::endl;
+    if (true)
+    {
+        std::vector<int> keys;
+        std::vector<int> lookups;
+        srand(42);
+        for (int i = 0; i != 100000; i++)
+            keys.push_back(rand() % 1000000);
+        for (int i = 0; i != 1000000; i++)
+            lookups.push_back(rand() % 1000000);
+        bench_value_size<8>(keys, lookups);
+        bench_value_size<64>(keys, lookups);
+        bench_value_size<256>(keys, lookups);
+        bench_value_size<1024>(keys, lookups);
+    }
+    std::cout <<GREEN<< "//TEST NODES FROM Alloc (aligned_allocator<64>)///" <<RESET<< std::endl;
+    if (true)
+    {
+        typedef ft::aligned_allocator<ft::pair<const int, int>, 64>  aligned;
+        ft::split_map<int, int, ft::less<int>, aligned>    ft_aligned;
+        std::map<int, int>                            std_aligned;
+        bool                                          all_aligned = true;
+
+        for (int i = 0; i != 100; i++)
+        {
+            ft_aligned.insert(ft::make_pair((i * 37) % 100, i));
+            std_aligned.insert(std::make_pair((i * 37) % 100, i));
+        }
+        ft_aligned.erase(ft_aligned.begin());
+        std_aligned.erase(std_aligned.begin());
+        ft_aligned.erase(ft_aligned.find(50), ft_aligned.find(60));
+        std_aligned.erase(std_aligned.find(50), std_aligned.find(60));
+        bool same = ft_aligned.size() == std_aligned.size();
+        std::map<int, int>::iterator std_it = std_aligned.begin();
+        for (ft::split_map<int, int, ft::less<int>, aligned>::iterator it = ft_aligned.begin(); same && it != ft_aligned.end(); it++, std_it++)
+        {
+            same = it->first == std_it->first && it->second == std_it->second;
+            all_aligned &= ((size_t)it.base() % 64 == 0);
+        }
+        std::cout <<BLUE<< "ft_split_map matches std_map: " <<RESET<< same << " | ";
+        std::cout <<BLUE<< "every node 64-byte aligned: " <<RESET<< all_aligned << std::endl;
+    }
+#ifdef FT_CXX11
+    std::cout <<GREEN<< "//TEST EMPLACE & RVALUE INSERT///" <<RESET<< std::endl;
+    if (true)
+    {
+        ft::split_map<int, std::string>             ft_map2;
+        std::map<int, std::string>              std_map2;
+        std::string                             ft_str(40, 'a');
+        std::string                             std_str(40, 'a');
+        ft::pair<const int, std::string>        ft_entry(2, std::string(40, 'b'));
+        std::pair<const int, std::string>       std_entry(2, std::string(40, 'b'));
+
+        std::cout <<BLUE<< "ft emplace: " <<RESET<< ft_map2.emplace(1, std::move(ft_str)).second << " | ";
+        std::cout <<BLUE<< "std emplace: " <<RESET<< std_map2.emplace(1, std::move(std_str)).second << std::endl;
+        std::cout <<BLUE<< "ft moved-from size: " <<RESET<< ft_str.size() << " | ";
+        std::cout <<BLUE<< "std moved-from size: " <<RESET<< std_str.size() << std::endl;
+        std::cout <<BLUE<< "ft insert rvalue: " <<RESET<< ft_map2.insert(std::move(ft_entry)).second << " | ";
+        std::cout <<BLUE<< "std insert rvalue: " <<RESET<< std_map2.insert(std::move(std_entry)).second << std::endl;
+        std::cout <<BLUE<< "ft moved-from size: " <<RESET<< ft_entry.second.size() << " | ";
+        std::cout <<BLUE<< "std moved-from size: " <<RESET<< std_entry.second.size() << std::endl;
+        std::cout <<BLUE<< "ft emplace duplicate: " <<RESET<< ft_map2.emplace(1, "dup").second << " | ";
+        std::cout <<BLUE<< "std emplace duplicate: " <<RESET<< std_map2.emplace(1, "dup").second << std::endl;
+        std::cout <<BLUE<< "ft values: " <<RESET<< ft_map2[1].size() << " " << ft_map2[2].size() << " | ";
+        std::cout <<BLUE<< "std values: " <<RESET<< std_map2[1].size() << " " << std_map2[2].size() << std::endl;
+    }
+#endif
+}
@@ -6,6 +6,7 @@
 #include "stack.hpp"
 #include "map.hpp"
 #include <map>
+#include <iterator>
 
 #define RED   "\x1b[31m"
 #define GREEN   "\x1b[32m"
@@ -31,7 +32,7 @@ int main()
         time_std = clock() - time_std;
         std::cout <<BLUE<< "ft_stack empty: " <<RESET<< ft_stack.empty() << " | ";
         std::cout <<BLUE<< "std_stack empty: " <<RESET<< ft_stack.empty() << std::endl;
-        if (time_ft / time_std >= 20)
+        if (time_std != 0 && time_ft / time_std >= 20)
             std::cout << RED<<"YOUR TIME IS SO BAD" <<RESET<< std::endl;
         else if (time_ft > time_std)
         {
@@ -65,7 +66,7 @@ int main()
         std::cout <<BLUE<< "std_stack top: " <<RESET<< ft_stack.top() << std::endl;
         std::cout <<BLUE<< "ft_stack size: " <<RESET<< ft_stack.size() <<RESET<< " | ";
         std::cout <<BLUE<< "std_stack size: " <<RESET<< ft_stack.size() << std::endl;
-        if (time_ft / time_std >= 20)
+        if (time_std != 0 && time_ft / time_std >= 20)
             std::cout << RED<<"YOUR TIME IS SO BAD" <<RESET<< std::endl;
         else if (time_ft > time_std)
         {
@@ -92,7 +93,7 @@ int main()
         std::cout <<BLUE<< "std_stack top: " <<RESET<< ft_stack.top() << std::endl;
         std::cout <<BLUE<< "ft_stack size: " <<RESET<< ft_stack.size() <<RESET<< " | ";
         std::cout <<BLUE<< "std_stack size: " <<RESET<< ft_stack.size() << std::endl;
-        if (time_ft / time_std >= 20)
+        if (time_std != 0 && time_ft / time_std >= 20)
             std::cout << RED<<"YOUR TIME IS SO BAD" <<RESET<< std::endl;
         else if (time_ft > time_std)
         {
@@ -142,5 +143,126 @@ int main()
         std::cout <<BLUE<< "ft_stack >=: " <<RESET<< (ft_stack2 >= ft_stack1) << " | ";
         std::cout <<BLUE<< "std_stack >=: " <<RESET<< (std_stack2 >= std_stack1) << std::endl;
     }
+    std::cout << GREEN << "///TEST SHRINK_TO_FIT///" << RESET << std::endl;
+    if (true)
+    {
+        ft::stack<int>          ft_stack;
+        std::stack<int>         std_stack;
+
+        for (int i = 0; i != 100000; i++)
+        {
+            ft_stack.push(i);
+            std_stack.push(i);
+        }
+        for (int i = 0; i != 99990; i++)
+        {
+            ft_stack.pop();
+            std_stack.pop();
+        }
+        ft_stack.shrink_to_fit();
+        std::cout <<BLUE<< "ft_stack top: " <<RESET<< ft_stack.top() << " | ";
+        std::cout <<BLUE<< "std_stack top: " <<RESET<< std_stack.top() << std::endl;
+        std::cout <<BLUE<< "ft_stack size: " <<RESET<< ft_stack.size() << " | ";
+        std::cout <<BLUE<< "std_stack size: " <<RESET<< std_stack.size() << std::endl;
+    }
+    std::cout << GREEN << "///TEST RESERVE, PUSH_RANGE, POP_N & ADOPT///" << RESET << std::endl;
+    if (true)
+    {
+        ft::stack<int>          ft_stack;
+        std::stack<int>         std_stack;
+        ft::vector<int>         batch;
+        std::vector<int>        ft_out;
+        std::vector<int>        std_out;
+
+        for (int i = 0; i != 256; i++)
+            batch.push_back(i * 3);
+        ft_stack.reserve(512);
+        ft_stack.push_range(batch.begin(), batch.end());
+        ft_stack.push_range(batch.begin(), batch.begin() + 10);
+        for (int i = 0; i != 256; i++)
+            std_stack.push(batch[i]);
+        for (int i = 0; i != 10; i++)
+            std_stack.push(batch[i]);
+        ft_stack.pop_n(100, std::back_inserter(ft_out));
+        for (int i = 0; i != 100; i++)
+        {
+            std_out.push_back(std_stack.top());
+            std_stack.pop();
+        }
+        std::cout <<BLUE<< "ft_stack top: " <<RESET<< ft_stack.top() << " | ";
+        std::cout <<BLUE<< "std_stack top: " <<RESET<< std_stack.top() << std::endl;
+        std::cout <<BLUE<< "ft_stack size: " <<RESET<< ft_stack.size() << " | ";
+        std::cout <<BLUE<< "std_stack size: " <<RESET<< std_stack.size() << " | ";
+        std::cout <<BLUE<< "same popped order: " <<RESET<< (ft_out == std_out) << std::endl;
+        try
+        {
+            ft_stack.pop_n(1000, std::back_inserter(ft_out));
+        }
+        catch (const std::out_of_range& e)
+        {
+            std::cout <<BLUE<< "pop_n past the bottom: " <<RESET<< e.what() << " | ";
+            std::cout <<BLUE<< "size after: " <<RESET<< ft_stack.size() << std::endl;
+        }
+
+        ft::vector<std::string> names(1000, std::string(32, 'n'));
+        ft::stack<std::string>  ft_adopted(names, ft::adopt);
+        std::cout <<BLUE<< "adopted size: " <<RESET<< ft_adopted.size() << " | ";
+        std::cout <<BLUE<< "container left: " <<RESET<< names.size() << std::endl;
+    }
+    std::cout << GREEN << "///TEST BATCHES (256 per batch, 20000 batches)///" << RESET << std::endl;
+    if (true)
+    {
+        ft::stack<int>          ft_stack;
+        std::stack<int>         std_stack;
+        ft::vector<int>         batch(256, 7);
+        ft::vector<int>         out(256);
+        long                    ft_sum = 0;
+        long                    std_sum = 0;
+
+        time_ft = clock();
+        ft_stack.reserve(256);
+        for (int b = 0; b != 20000; b++)
+        {
+            ft_stack.push_range(batch.begin(), batch.end());
+            ft_stack.pop_n(256, out.begin());
+            ft_sum += out[b % 256];
+        }
+        time_ft = clock() - time_ft;
+        time_std = clock();
+        for (int b = 0; b != 20000; b++)
+        {
+            for (int i = 0; i != 256; i++)
+                std_stack.push(batch[i]);
+            for (int i = 0; i != 256; i++)
+            {
+                out[i] = std_stack.top();
+                std_stack.pop();
+            }
+            std_sum += out[b % 256];
+        }
+        time_std = clock() - time_std;
+        std::cout <<BLUE<< "same sums: " <<RESET<< (ft_sum == std_sum) << " | ";
+        std::cout <<BLUE<< "ft_stack push_range + pop_n time: " <<RESET<< time_ft << " | ";
+        std::cout <<BLUE<< "std_stack push + top + pop time: " <<RESET<< time_std << std::endl;
+    }
+#ifdef FT_CXX11
+    std::cout << GREEN << "///TEST PUSH RVALUE & EMPLACE///" << RESET << std::endl;
+    if (true)
+    {
+        ft::stack<std::string> ft_stack;
+        std::stack<std::string> std_stack;
+        std::string str(40, 'z');
 
+        ft_stack.push(std::string("pushed"));
+        std_stack.push(std::string("pushed"));
+        ft_stack.emplace(5, 'e');
+        std_stack.emplace(5, 'e');
+        ft::stack<std::string> ft_stack2(std::move(ft_stack));
+        std::stack<std::string> std_stack2(std::move(std_stack));
+        std::cout <<BLUE<< "ft_stack top: " <<RESET<< ft_stack2.top() << " | ";
+        std::cout <<BLUE<< "std_stack top: " <<RESET<< std_stack2.top() << std::endl;
+        std::cout <<BLUE<< "ft_stack size: " <<RESET<< ft_stack2.size() << " | ";
+        std::cout <<BLUE<< "std_stack size: " <<RESET<< std_stack2.size() << std::endl;
+    }
+#endif
 }
\ No newline at end of file
@@ -1,7 +1,15 @@
 #include "vector.hpp"
+#include "mmap_allocator.hpp"
+#include "aligned_allocator.hpp"
 #include <vector>
+#include <string>
+#include <algorithm>
+#include <sstream>
+#include <iterator>
 #include <iostream>
 #include <time.h>
+#include <sys/resource.h>
+#include <unistd.h>
 
 #define RED   "\x1b[31m"
 #define GREEN   "\x1b[32m"
@@ -11,6 +19,190 @@
 #define CYAN    "\x1b[36m"
 #define RESET   "\x1b[0m"
 
+struct pod64
+{
+    int     key;
+    char    pad[60];
+};
+
+bool operator==(const pod64& a, const pod64& b) { return (a.key == b.key); }
+
+template <class V>
+V make_value(int i)
+{
+    return (V(i));
+}
+
+template <>
+pod64 make_value<pod64>(int i)
+{
+    pod64 p;
+
+    p.key = i;
+    p.pad[0] = 0;
+    return (p);
+}
+
+#ifdef FT_CXX11
+/* Counts copies; its moves cannot throw, so relocation should never copy it. */
+struct copy_counter
+{
+    static long copies;
+
+    copy_counter() {}
+    copy_counter(const copy_counter&) { copies++; }
+    copy_counter(copy_counter&&) noexcept {}
+    copy_counter& operator=(const copy_counter&) { copies++; return (*this); }
+    copy_counter& operator=(copy_counter&&) noexcept { return (*this); }
+};
+
+long copy_counter::copies = 0;
+#endif
+
+/* Element type whose vectors give memory back as they empty */
+struct burst_item
+{
+    int     id;
+};
+
+namespace ft
+{
+    template <>
+    struct vector_growth<burst_item> : public ft::shrinking_growth<> {};
+}
+
+/* push_back growth, front insert/erase shifts and copies of trivially copyable values */
+template <class V>
+void bench_trivial(const char *name)
+{
+    ft::vector<V>   ft_vector;
+    std::vector<V>  std_vector;
+    clock_t         time_ft;
+    clock_t         time_std;
+
+    time_ft = clock();
+    for (int i = 0; i != 1000000; i++)
+        ft_vector.push_back(make_value<V>(i));
+    for (int i = 0; i != 500; i++)
+        ft_vector.insert(ft_vector.begin() + 1, make_value<V>(i));
+    for (int i = 0; i != 500; i++)
+        ft_vector.erase(ft_vector.begin() + 1);
+    for (int i = 0; i != 20; i++)
+    {
+        ft::vector<V> copy(ft_vector);
+        ft_vector.assign(copy.begin(), copy.end());
+    }
+    time_ft = clock() - time_ft;
+    time_std = clock();
+    for (int i = 0; i != 1000000; i++)
+        std_vector.push_back(make_value<V>(i));
+    for (int i = 0; i != 500; i++)
+        std_vector.insert(std_vector.begin() + 1, make_value<V>(i));
+    for (int i = 0; i != 500; i++)
+        std_vector.erase(std_vector.begin() + 1);
+    for (int i = 0; i != 20; i++)
+    {
+        std::vector<V> copy(std_vector);
+        std_vector.assign(copy.begin(), copy.end());
+    }
+    time_std = clock() - time_std;
+    std::cout <<CYAN<< name <<RESET<< std::endl;
+    std::cout <<BLUE<< "ft_vector equal: " <<RESET<< (ft_vector.size() == std_vector.size()
+        && ft::equal(ft_vector.begin(), ft_vector.end(), std_vector.begin())) << std::endl;
+    std::cout <<BLUE<< "ft_vector time: " <<RESET<< time_ft << " | ";
+    std::cout <<BLUE<< "std_vector time: " <<RESET<< time_std << std::endl;
+}
+
+/* Grows a full vector from 1M to 32M elements; only the reserve() calls are timed. */
+template <class Vec>
+void bench_big_growth(const char *name)
+{
+    Vec             v;
+    clock_t         time = 0;
+    clock_t         start;
+    struct rusage   usage;
+
+    v.reserve(1 << 20);
+    while (v.capacity() < (1 << 25))
+    {
+        while (v.size() != v.capacity())
+            v.push_back(v.size());
+        start = clock();
+        v.reserve(v.capacity() * 2);
+        time += clock() - start;
+    }
+    getrusage(RUSAGE_SELF, &usage);
+    std::cout <<CYAN<< name <<RESET<< std::endl;
+    std::cout <<BLUE<< "capacity: " <<RESET<< v.capacity() << " | ";
+    std::cout <<BLUE<< "last: " <<RESET<< v.back() << " | ";
+    std::cout <<BLUE<< "reserve time: " <<RESET<< time << " | ";
+    std::cout <<BLUE<< "peak rss so far (KB): " <<RESET<< usage.ru_maxrss << std::endl;
+}
+
+/* ==, < and > on two 16M-element vectors that only differ in their last element. */
+template <class V>
+void bench_compare(const char *name)
+{
+    ft::vector<V>   ft_a(1 << 24, V(7));
+    ft::vector<V>   ft_b(ft_a);
+    std::vector<V>  std_a(1 << 24, V(7));
+    std::vector<V>  std_b(std_a);
+    int             ft_res = 0;
+    int             std_res = 0;
+    clock_t         time_ft;
+    clock_t         time_std;
+
+    ft_b.back() = V(9);
+    std_b.back() = V(9);
+    time_ft = clock();
+    for (int i = 0; i != 10; i++)
+        ft_res += (ft_a == ft_b) + (ft_a < ft_b) * 2 + (ft_a > ft_b) * 4;
+    time_ft = clock() - time_ft;
+    time_std = clock();
+    for (int i = 0; i != 10; i++)
+        std_res += (std_a == std_b) + (std_a < std_b) * 2 + (std_a > std_b) * 4;
+    time_std = clock() - time_std;
+    std::cout <<CYAN<< name <<RESET<< std::endl;
+    if (ft_res == std_res)
+        std::cout <<BLUE<< "result: " <<RESET<< ft_res << " | ";
+    else
+        std::cout <<BLUE<< "result: " <<RED<< ft_res << " / " << std_res <<RESET<< " | ";
+    std::cout <<BLUE<< "ft_vector time: " <<RESET<< time_ft << " | ";
+    std::cout <<BLUE<< "std_vector time: " <<RESET<< time_std << std::endl;
+}
+
+struct is_even
+{
+    bool operator()(int x) const { return (x % 2 == 0); }
+};
+
+/*
+** y += a * x, 8 floats per step: aligned loads and stores running through the
+** padded tail, or unaligned ones with a scalar loop for the last few.
+*/
+#ifdef FT_SIMD_X86
+__attribute__((target("avx")))
+void saxpy_aligned(float a, const float *x, float *y, size_t n)
+{
+    __m256  va = _mm256_set1_ps(a);
+
+    for (size_t i = 0; i < n; i += 8)
+        _mm256_store_ps(y + i, _mm256_add_ps(_mm256_mul_ps(va, _mm256_load_ps(x + i)), _mm256_load_ps(y + i)));
+}
+
+__attribute__((target("avx")))
+void saxpy_unaligned(float a, const float *x, float *y, size_t n)
+{
+    __m256  va = _mm256_set1_ps(a);
+    size_t  i = 0;
+
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_ps(y + i, _mm256_add_ps(_mm256_mul_ps(va, _mm256_loadu_ps(x + i)), _mm256_loadu_ps(y + i)));
+    for (; i != n; i++)
+        y[i] += a * x[i];
+}
+#endif
+
 void print_vector_int(ft::vector<int>::iterator ft_it, std::vector<int>::iterator std_it, ft::vector<int> ft_vector, std::vector<int>  std_vector, clock_t time_ft, clock_t time_std)
 {
     ft_it = ft_vector.begin();
@@ -48,7 +240,7 @@ void print_vector_int(ft::vector<int>::iterator ft_it, std::vector<int>::iterato
         std::cout <<BLUE<< "ft_vector capacity: " <<RED<< ft_vector.capacity() <<RESET<< " | ";
     std::cout <<BLUE<< "std_vector capacity: " <<RESET<< std_vector.capacity() << std::endl;
     
-    if (time_ft / time_std >= 20)
+    if (time_std != 0 && time_ft / time_std >= 20)
         std::cout << RED<<"YOUR TIME IS SO BAD" <<RESET<< std::endl;
     else if (time_ft > time_std)
     {
@@ -277,4 +469,477 @@ int main()
         std::cout <<BLUE<< "std_vector >=: " <<RESET<< (std_vector2 >= std_vector1) << std::endl;
 
     }
+    std::cout <<GREEN<< "//TEST GROWTH (repeated small range insert)///" <<RESET<< std::endl;
+    if (true)
+    {
+        int                 src[4] = {1, 2, 3, 4};
+        ft::vector<int>     ft_vector2;
+        std::vector<int>    std_vector2;
+        clock_t             time_ft;
+        clock_t             time_std;
+
+        time_ft = clock();
+        for (int i = 0; i != 20000; i++)
+            ft_vector2.insert(ft_vector2.end(), src, src + 4);
+        time_ft = clock() - time_ft;
+        time_std = clock();
+        for (int i = 0; i != 20000; i++)
+            std_vector2.insert(std_vector2.end(), src, src + 4);
+        time_std = clock() - time_std;
+        std::cout <<BLUE<< "ft_vector size: " <<RESET<< ft_vector2.size() << " | ";
+        std::cout <<BLUE<< "std_vector size: " <<RESET<< std_vector2.size() << std::endl;
+        std::cout <<BLUE<< "ft_vector equal: " <<RESET<< ft::equal(ft_vector2.begin(), ft_vector2.end(), std_vector2.begin()) << std::endl;
+        std::cout <<BLUE<< "ft_vector time: " <<RESET<< time_ft << " | ";
+        std::cout <<BLUE<< "std_vector time: " <<RESET<< time_std << std::endl;
+    }
+    std::cout <<GREEN<< "//TEST TRIVIALLY COPYABLE FAST PATH///" <<RESET<< std::endl;
+    if (true)
+    {
+        bench_trivial<int>("int");
+        bench_trivial<double>("double");
+        bench_trivial<pod64>("64-byte POD");
+    }
+    std::cout <<GREEN<< "//TEST STRING GROWTH (1M heap-backed strings)///" <<RESET<< std::endl;
+    if (true)
+    {
+        std::string                 str(40, 'x');
+        ft::vector<std::string>     ft_vector2;
+        std::vector<std::string>    std_vector2;
+        clock_t                     time_ft;
+        clock_t                     time_std;
+
+        time_ft = clock();
+        for (int i = 0; i != 1000000; i++)
+            ft_vector2.push_back(str);
+        time_ft = clock() - time_ft;
+        time_std = clock();
+        for (int i = 0; i != 1000000; i++)
+            std_vector2.push_back(str);
+        time_std = clock() - time_std;
+        std::cout <<BLUE<< "ft_vector size: " <<RESET<< ft_vector2.size() << " | ";
+        std::cout <<BLUE<< "std_vector size: " <<RESET<< std_vector2.size() << std::endl;
+        std::cout <<BLUE<< "ft_vector time: " <<RESET<< time_ft << " | ";
+        std::cout <<BLUE<< "std_vector time: " <<RESET<< time_std << std::endl;
+    }
+    std::cout <<GREEN<< "//TEST INPUT ITERATOR & RANGE CONSTRUCTOR///" <<RESET<< std::endl;
+    if (true)
+    {
+        std::istringstream              ft_in("1 2 3 4 5");
+        std::istringstream              std_in("1 2 3 4 5");
+        std::istream_iterator<int>      eof;
+        ft::vector<int>                 ft_vector2((std::istream_iterator<int>(ft_in)), eof);
+        std::vector<int>                std_vector2((std::istream_iterator<int>(std_in)), eof);
+        std::istringstream              ft_in2("7 8");
+        std::istringstream              std_in2("7 8");
+
+        ft_vector2.insert(ft_vector2.begin() + 1, std::istream_iterator<int>(ft_in2), eof);
+        std_vector2.insert(std_vector2.begin() + 1, std::istream_iterator<int>(std_in2), eof);
+        for (size_t i = 0; i != std_vector2.size() || i != ft_vector2.size(); i++)
+        {
+            if (i < ft_vector2.size() && i < std_vector2.size() && ft_vector2[i] == std_vector2[i])
+                std::cout <<MAGENTA<< "ft_vector: " <<RESET<< ft_vector2[i] << " | ";
+            else
+                std::cout <<MAGENTA<< "ft_vector: " <<RED<< (i < ft_vector2.size() ? ft_vector2[i] : -1) <<RESET<< " | ";
+            std::cout <<MAGENTA<< "std_vector: " <<RESET<< (i < std_vector2.size() ? std_vector2[i] : -1) << std::endl;
+        }
+
+        ft::vector<int>     ft_big(1000000, 42);
+        std::vector<int>    std_big(1000000, 42);
+        clock_t             time_ft;
+        clock_t             time_std;
+
+        time_ft = clock();
+        for (int i = 0; i != 20; i++)
+        {
+            ft::vector<int> copy(ft_big.begin(), ft_big.end());
+        }
+        time_ft = clock() - time_ft;
+        time_std = clock();
+        for (int i = 0; i != 20; i++)
+        {
+            std::vector<int> copy(std_big.begin(), std_big.end());
+        }
+        time_std = clock() - time_std;
+        std::cout <<BLUE<< "ft_vector(first, last) x20 time: " <<RESET<< time_ft << " | ";
+        std::cout <<BLUE<< "std_vector(first, last) x20 time: " <<RESET<< time_std << std::endl;
+    }
+    std::cout <<GREEN<< "//TEST MMAP GROWTH (1M -> 32M unsigned long long)///" <<RESET<< std::endl;
+    if (true)
+    {
+        bench_big_growth<ft::vector<unsigned long long, ft::mmap_allocator<unsigned long long> > >("ft::vector + mmap_allocator");
+        bench_big_growth<ft::vector<unsigned long long, ft::mmap_allocator<unsigned long long, 1024 * 1024, true> > >("ft::vector + mmap_allocator + MADV_HUGEPAGE");
+        bench_big_growth<ft::vector<unsigned long long> >("ft::vector + std::allocator");
+    }
+    std::cout <<GREEN<< "//TEST SPARE CAPACITY & DEFAULT INIT///" <<RESET<< std::endl;
+    if (true)
+    {
+        int                 fds[2];
+        int                 src[1000];
+        ft::vector<int>     ft_vector2;
+        ssize_t             got = 0;
+
+        for (int i = 0; i != 1000; i++)
+            src[i] = i * 3;
+        if (pipe(fds) == 0)
+        {
+            if (write(fds[1], src, sizeof(src)) == (ssize_t)sizeof(src))
+            {
+                ft_vector2.reserve(1000);
+                got = read(fds[0], ft_vector2.spare_data(), ft_vector2.spare_capacity() * sizeof(int));
+                if (got > 0)
+                    ft_vector2.commit_spare(got / sizeof(int));
+            }
+            close(fds[0]);
+            close(fds[1]);
+        }
+        std::cout <<BLUE<< "ft_vector read size: " <<RESET<< ft_vector2.size() << " | ";
+        std::cout <<BLUE<< "ft_vector equal: " <<RESET<< ft::equal(ft_vector2.begin(), ft_vector2.end(), src) << " | ";
+        std::cout <<BLUE<< "spare left: " <<RESET<< ft_vector2.spare_capacity() << std::endl;
+
+        ft::vector<unsigned int>    ft_zeroed;
+        ft::vector<unsigned int>    ft_raw;
+        std::vector<unsigned int>   std_zeroed;
+        clock_t                     time_zeroed;
+        clock_t                     time_raw;
+        clock_t                     time_std;
+
+        time_zeroed = clock();
+        ft_zeroed.resize(1 << 24);
+        time_zeroed = clock() - time_zeroed;
+        time_raw = clock();
+        ft_raw.resize_default_init(1 << 24);
+        time_raw = clock() - time_raw;
+        time_std = clock();
+        std_zeroed.resize(1 << 24);
+        time_std = clock() - time_std;
+        std::cout <<BLUE<< "ft_vector resize(16M) time: " <<RESET<< time_zeroed << " | ";
+        std::cout <<BLUE<< "resize_default_init(16M) time: " <<RESET<< time_raw << " | ";
+        std::cout <<BLUE<< "std_vector resize(16M) time: " <<RESET<< time_std << std::endl;
+    }
+    std::cout <<GREEN<< "//TEST COMPARISON FAST PATH (16M elements, last one differs)///" <<RESET<< std::endl;
+    if (true)
+    {
+        bench_compare<unsigned char>("unsigned char");
+        bench_compare<int>("int");
+        bench_compare<long>("long");
+    }
+    std::cout <<GREEN<< "//TEST SHRINK_TO_FIT & AUTO SHRINK (1M element burst)///" <<RESET<< std::endl;
+    if (true)
+    {
+        ft::vector<int>             ft_vector1(1000000, 7);
+        std::vector<int>            std_vector1(1000000, 7);
+
+        ft_vector1.clear();
+        std_vector1.clear();
+        std::cout <<BLUE<< "ft_vector capacity after clear: " <<RESET<< ft_vector1.capacity() << " | ";
+        std::cout <<BLUE<< "std_vector capacity after clear: " <<RESET<< std_vector1.capacity() << std::endl;
+        ft_vector1.shrink_to_fit();
+        std::vector<int>(std_vector1).swap(std_vector1);
+        std::cout <<BLUE<< "ft_vector capacity after shrink_to_fit: " <<RESET<< ft_vector1.capacity() << " | ";
+        std::cout <<BLUE<< "std_vector capacity after shrink_to_fit: " <<RESET<< std_vector1.capacity() << std::endl;
+
+        ft::vector<burst_item>      ft_burst;
+        burst_item                  item;
+        size_t                      reallocations = 0;
+
+        for (int i = 0; i != 1000000; i++)
+        {
+            item.id = i;
+            ft_burst.push_back(item);
+        }
+        std::cout <<BLUE<< "auto shrink capacity at 1M: " <<RESET<< ft_burst.capacity() << " | ";
+        while (ft_burst.size() > 1000)
+            ft_burst.pop_back();
+        std::cout <<BLUE<< "at 1000: " <<RESET<< ft_burst.capacity() << " | ";
+        for (int i = 0; i != 100000; i++)
+        {
+            size_t capacity = ft_burst.capacity();
+            if (i % 2)
+                ft_burst.pop_back();
+            else
+                ft_burst.push_back(item);
+            if (ft_burst.capacity() != capacity)
+                reallocations++;
+        }
+        std::cout <<BLUE<< "reallocations over 100000 push/pop at the edge: " <<RESET<< reallocations << " | ";
+        ft_burst.erase(ft_burst.begin() + 10, ft_burst.end());
+        std::cout <<BLUE<< "after erase to 10: " <<RESET<< ft_burst.capacity() << " | ";
+        std::cout <<BLUE<< "front id: " <<RESET<< ft_burst.front().id << std::endl;
+
+        ft::vector<int, ft::mmap_allocator<int> >   ft_mapped(4 << 20, 1);
+        int                                         *before = &ft_mapped[0];
+
+        ft_mapped.resize(2 << 20);
+        ft_mapped.shrink_to_fit();
+        std::cout <<BLUE<< "mmap_allocator shrink_to_fit capacity: " <<RESET<< ft_mapped.capacity() << " | ";
+        std::cout <<BLUE<< "in place: " <<RESET<< (before == &ft_mapped[0]) << " | ";
+        std::cout <<BLUE<< "last: " <<RESET<< ft_mapped.back() << std::endl;
+    }
+    std::cout <<GREEN<< "//TEST VECTOR<BOOL>///" <<RESET<< std::endl;
+    if (true)
+    {
+        ft::vector<bool>            ft_bits;
+        std::vector<bool>           std_bits;
+
+        for (int i = 0; i != 200; i++)
+        {
+            ft_bits.push_back(i % 3 == 0);
+            std_bits.push_back(i % 3 == 0);
+        }
+        ft_bits.insert(ft_bits.begin() + 5, 70, true);
+        std_bits.insert(std_bits.begin() + 5, 70, true);
+        ft_bits.erase(ft_bits.begin() + 100, ft_bits.begin() + 130);
+        std_bits.erase(std_bits.begin() + 100, std_bits.begin() + 130);
+        ft_bits[1] = true;
+        std_bits[1] = true;
+        ft_bits.back().flip();
+        std_bits.back().flip();
+        ft_bits.reset_range(10, 20);
+        for (int i = 10; i != 20; i++)
+            std_bits[i] = false;
+        size_t  found = 0;
+        for (size_t i = ft_bits.find_first(); i != ft_bits.size(); i = ft_bits.find_next(i))
+            found++;
+        std::cout <<BLUE<< "equal: " <<RESET<< (ft_bits.size() == std_bits.size()
+            && ft::equal(ft_bits.begin(), ft_bits.end(), std_bits.begin())) << " | ";
+        std::cout <<BLUE<< "ft count: " <<RESET<< ft_bits.count() << " | ";
+        std::cout <<BLUE<< "std count: " <<RESET<< std::count(std_bits.begin(), std_bits.end(), true) << " | ";
+        std::cout <<BLUE<< "find_next walk: " <<RESET<< found << std::endl;
+
+        size_t                      n = 1 << 22;
+        ft::vector<bool>            ft_a(n, false);
+        ft::vector<bool>            ft_b(n, false);
+        std::vector<bool>           std_a(n, false);
+        std::vector<bool>           std_b(n, false);
+        ft::vector<unsigned char>   byte_a(n, 0);
+        ft::vector<unsigned char>   byte_b(n, 0);
+        size_t                      ft_count = 0;
+        size_t                      std_count = 0;
+        size_t                      byte_count = 0;
+        clock_t                     time_ft;
+        clock_t                     time_std;
+        clock_t                     time_byte;
+
+        for (size_t i = 0; i < n; i += 3)
+        {
+            ft_a[i] = true;
+            std_a[i] = true;
+            byte_a[i] = 1;
+        }
+        ft_b.set_range(n / 4, n);
+        for (size_t i = n / 4; i != n; i++)
+        {
+            std_b[i] = true;
+            byte_b[i] = 1;
+        }
+        time_ft = clock();
+        for (int pass = 0; pass != 10; pass++)
+        {
+            ft_a &= ft_b;
+            ft_count += ft_a.count();
+        }
+        time_ft = clock() - time_ft;
+        time_std = clock();
+        for (int pass = 0; pass != 10; pass++)
+        {
+            for (size_t i = 0; i != n; i++)
+                std_a[i] = std_a[i] && std_b[i];
+            std_count += std::count(std_a.begin(), std_a.end(), true);
+        }
+        time_std = clock() - time_std;
+        time_byte = clock();
+        for (int pass = 0; pass != 10; pass++)
+        {
+            for (size_t i = 0; i != n; i++)
+                byte_a[i] &= byte_b[i];
+            for (size_t i = 0; i != n; i++)
+                byte_count += byte_a[i];
+        }
+        time_byte = clock() - time_byte;
+        std::cout <<CYAN<< "a &= b; a.count() (4M flags, 10 passes)" <<RESET<< std::endl;
+        std::cout <<BLUE<< "same count: " <<RESET<< (ft_count == std_count && ft_count == byte_count) << " | ";
+        std::cout <<BLUE<< "ft::vector<bool> time: " <<RESET<< time_ft << " | ";
+        std::cout <<BLUE<< "std::vector<bool> time: " <<RESET<< time_std << " | ";
+        std::cout <<BLUE<< "one byte per flag time: " <<RESET<< time_byte << std::endl;
+        std::cout <<BLUE<< "ft::vector<bool> bytes: " <<RESET<< ft_a.capacity() / 8 << " | ";
+        std::cout <<BLUE<< "one byte per flag bytes: " <<RESET<< byte_a.capacity() << std::endl;
+    }
+    std::cout <<GREEN<< "//TEST ALIGNED_ALLOCATOR///" <<RESET<< std::endl;
+    if (true)
+    {
+        size_t                                                  n = 4099;
+        ft::vector<float, ft::aligned_allocator<float, 32> >    ft_x(n, 1.0f);
+        ft::vector<float, ft::aligned_allocator<float, 32> >    ft_y(n, 2.0f);
+        ft::vector<float, ft::aligned_allocator<float, 4096> >  ft_page(10, 0.0f);
+        ft::vector<bool, ft::aligned_allocator<bool, 64> >      ft_bits(1000, true);
+
+        ft_y.push_back(3.0f);
+        ft_y.pop_back();
+        std::cout <<BLUE<< "32-byte aligned: " <<RESET<< ((size_t)ft_x.data() % 32 == 0 && (size_t)ft_y.data() % 32 == 0) << " | ";
+        std::cout <<BLUE<< "capacity for " << n << ": " <<RESET<< ft_x.capacity() << " | ";
+        std::cout <<BLUE<< "page aligned: " <<RESET<< ((size_t)ft_page.data() % 4096 == 0) << " | ";
+        std::cout <<BLUE<< "page capacity: " <<RESET<< ft_page.capacity() << " | ";
+        std::cout <<BLUE<< "bits: " <<RESET<< ft_bits.count() << std::endl;
+#ifdef FT_SIMD_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx"))
+        {
+            ft::vector<float>   ft_ux(n + 1, 1.0f);
+            ft::vector<float>   ft_uy(n + 1, 2.0f);
+            float               *ux = ft_ux.data() + 1;
+            float               *uy = ft_uy.data() + 1;
+            clock_t             time_aligned;
+            clock_t             time_unaligned;
+
+            time_aligned = clock();
+            for (int pass = 0; pass != 200000; pass++)
+                saxpy_aligned(0.5f, ft_x.data(), ft_y.data(), n);
+            time_aligned = clock() - time_aligned;
+            time_unaligned = clock();
+            for (int pass = 0; pass != 200000; pass++)
+                saxpy_unaligned(0.5f, ux, uy, n);
+            time_unaligned = clock() - time_unaligned;
+            std::cout <<CYAN<< "y += 0.5 * x over 4099 floats, 200000 passes" <<RESET<< std::endl;
+            std::cout <<BLUE<< "same result: " <<RESET<< ft::equal(ft_y.begin(), ft_y.end(), uy) << " | ";
+            std::cout <<BLUE<< "aligned + padded time: " <<RESET<< time_aligned << " | ";
+            std::cout <<BLUE<< "unaligned + scalar tail time: " <<RESET<< time_unaligned << std::endl;
+        }
+#endif
+    }
+    std::cout <<GREEN<< "//TEST ERASE_IF, ERASE & SWAP_REMOVE///" <<RESET<< std::endl;
+    if (true)
+    {
+        ft::vector<int>     ft_loop;
+        ft::vector<int>     ft_batch;
+        std::vector<int>    std_batch;
+        clock_t             time_loop;
+        clock_t             time_ft;
+
+        for (int i = 0; i != 100000; i++)
+        {
+            ft_loop.push_back(i * 7 % 1000);
+            ft_batch.push_back(i * 7 % 1000);
+            std_batch.push_back(i * 7 % 1000);
+        }
+        time_loop = clock();
+        for (ft::vector<int>::iterator it = ft_loop.begin(); it != ft_loop.end();)
+        {
+            if (is_even()(*it))
+                it = ft_loop.erase(it);
+            else
+                it++;
+        }
+        time_loop = clock() - time_loop;
+        time_ft = clock();
+        size_t removed = ft::erase_if(ft_batch, is_even());
+        time_ft = clock() - time_ft;
+        time_std = clock();
+        std_batch.erase(std::remove_if(std_batch.begin(), std_batch.end(), is_even()), std_batch.end());
+        time_std = clock() - time_std;
+        std::cout <<CYAN<< "drop the even values of 100000 ints" <<RESET<< std::endl;
+        std::cout <<BLUE<< "same result: " <<RESET<< (ft_batch.size() == std_batch.size() && ft_loop.size() == std_batch.size()
+            && ft::equal(ft_batch.begin(), ft_batch.end(), std_batch.begin())
+            && ft::equal(ft_loop.begin(), ft_loop.end(), std_batch.begin())) << " | ";
+        std::cout <<BLUE<< "removed: " <<RESET<< removed << std::endl;
+        std::cout <<BLUE<< "erase(it) loop time: " <<RESET<< time_loop << " | ";
+        std::cout <<BLUE<< "ft::erase_if time: " <<RESET<< time_ft << " | ";
+        std::cout <<BLUE<< "std remove_if + erase time: " <<RESET<< time_std << std::endl;
+
+        ft::vector<int>     ft_values(1 << 24);
+        std::vector<int>    std_values(1 << 24);
+
+        for (size_t i = 0; i != ft_values.size(); i++)
+        {
+            ft_values[i] = (int)((unsigned)(i * 2654435761u) >> 28);
+            std_values[i] = ft_values[i];
+        }
+        time_ft = clock();
+        removed = ft::erase(ft_values, 3);
+        time_ft = clock() - time_ft;
+        time_std = clock();
+        std_values.erase(std::remove(std_values.begin(), std_values.end(), 3), std_values.end());
+        time_std = clock() - time_std;
+        std::cout <<CYAN<< "erase the value 3 from 16M ints" <<RESET<< std::endl;
+        std::cout <<BLUE<< "same result: " <<RESET<< (ft_values.size() == std_values.size()
+            && ft::equal(ft_values.begin(), ft_values.end(), std_values.begin())) << " | ";
+        std::cout <<BLUE<< "removed: " <<RESET<< removed << " | ";
+        std::cout <<BLUE<< "ft::erase time: " <<RESET<< time_ft << " | ";
+        std::cout <<BLUE<< "std remove + erase time: " <<RESET<< time_std << std::endl;
+
+        ft::vector<int>             ft_alias;
+        ft::vector<std::string>     ft_alias_names;
+        for (int i = 0; i != 40; i++)
+        {
+            ft_alias.push_back(i % 3 == 0 ? -1 : i);
+            ft_alias_names.push_back(i % 3 == 0 ? "x" : std::string(2, 'a' + i % 26));
+        }
+        std::cout <<BLUE<< "erase(v, v[0]) removed: " <<RESET<< ft::erase(ft_alias, ft_alias[0]) << " "
+                  << ft::erase(ft_alias_names, ft_alias_names[0]) << " | ";
+        std::cout <<BLUE<< "expected: " <<RESET<< "14 14" << " | ";
+        std::cout <<BLUE<< "left: " <<RESET<< ft_alias.size() << " " << ft_alias_names.size() << " | ";
+        std::cout <<BLUE<< "expected: " <<RESET<< "26 26" << std::endl;
+
+        ft::vector<std::string>     ft_names;
+
+        ft_names.push_back("a");
+        ft_names.push_back("b");
+        ft_names.push_back("c");
+        ft_names.push_back("d");
+        ft_names.swap_remove(ft_names.begin() + 1);
+        ft_names.swap_remove(ft_names.end() - 1);
+        std::cout <<BLUE<< "swap_remove: " <<RESET;
+        for (size_t i = 0; i != ft_names.size(); i++)
+            std::cout << ft_names[i] << " ";
+        std::cout << std::endl;
+    }
+#ifdef FT_CXX11
+    std::cout <<GREEN<< "//TEST MOVE & EMPLACE///" <<RESET<< std::endl;
+    if (true)
+    {
+        ft::vector<std::string>     ft_vector2;
+        std::vector<std::string>    std_vector2;
+        std::string                 str(40, 'y');
+
+        ft_vector2.emplace_back(3, 'a');
+        std_vector2.emplace_back(3, 'a');
+        ft_vector2.push_back(std::move(str));
+        str = std::string(40, 'y');
+        std_vector2.push_back(std::move(str));
+        ft_vector2.emplace(ft_vector2.begin(), "front");
+        std_vector2.emplace(std_vector2.begin(), "front");
+        ft_vector2.insert(ft_vector2.begin() + 1, std::string("second"));
+        std_vector2.insert(std_vector2.begin() + 1, std::string("second"));
+        ft::vector<std::string>     ft_vector3(std::move(ft_vector2));
+        std::vector<std::string>    std_vector3(std::move(std_vector2));
+        for (size_t i = 0; i != std_vector3.size(); i++)
+        {
+            if (ft_vector3[i] == std_vector3[i])
+                std::cout <<MAGENTA<< "ft_vector: " <<RESET<< ft_vector3[i] << " | ";
+            else
+                std::cout <<MAGENTA<< "ft_vector: " <<RED<< ft_vector3[i] <<RESET<< " | ";
+            std::cout <<MAGENTA<< "std_vector: " <<RESET<< std_vector3[i] << std::endl;
+        }
+        std::cout <<BLUE<< "ft_vector moved-from size: " <<RESET<< ft_vector2.size() << " | ";
+        std::cout <<BLUE<< "std_vector moved-from size: " <<RESET<< std_vector2.size() << std::endl;
+        ft_vector2 = std::move(ft_vector3);
+        std_vector2 = std::move(std_vector3);
+        std::cout <<BLUE<< "ft_vector move-assigned size: " <<RESET<< ft_vector2.size() << " | ";
+        std::cout <<BLUE<< "std_vector move-assigned size: " <<RESET<< std_vector2.size() << std::endl;
+
+        ft::vector<copy_counter>                        ft_plain;
+        ft::vector<ft::pair<int, copy_counter> >        ft_pairs;
+        long                                            plain_copies;
+
+        copy_counter::copies = 0;
+        for (int i = 0; i != 1000; i++)
+            ft_plain.emplace_back();
+        plain_copies = copy_counter::copies;
+        copy_counter::copies = 0;
+        for (int i = 0; i != 1000; i++)
+            ft_pairs.emplace_back(i, copy_counter());
+        std::cout <<BLUE<< "copies growing vector<T>: " <<RESET<< plain_copies << " | ";
+        std::cout <<BLUE<< "copies growing vector<ft::pair<int, T> >: " <<RESET<< copy_counter::copies << " | ";
+        std::cout <<BLUE<< "ft::pair nothrow movable: " <<RESET<< std::is_nothrow_move_constructible<ft::pair<int, copy_counter> >::value << std::endl;
+    }
+#endif
 }
\ No newline at end of file
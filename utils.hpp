@@ -3,6 +3,25 @@
 #define UTILS_HPP
 
 #include <cstddef>
+
+/*
+** The containers build as C++98; under C++11 and later they also get move
+** constructors, move assignment and emplace. FT_MOVE_IF_NOEXCEPT is what the
+** containers use to relocate elements: a move when it cannot throw, a copy
+** otherwise, and always a copy in C++98.
+*/
+#if __cplusplus >= 201103L
+# define FT_CXX11 1
+# include <type_traits>
+# include <utility>
+# define FT_MOVE(x) std::move(x)
+# define FT_MOVE_IF_NOEXCEPT(x) std::move_if_noexcept(x)
+#else
+# define FT_MOVE(x) (x)
+# define FT_MOVE_IF_NOEXCEPT(x) (x)
+#endif
+
+#include "simd.hpp"
 #include "iterator.hpp"
 
 namespace ft
@@ -59,12 +78,208 @@ namespace ft
 	template<class T>
 	struct is_integral : ft::is_integral_type<T> {};
 
+	typedef is_integral_res<bool, true>		true_type;
+	typedef is_integral_res<bool, false>	false_type;
+
+	/*
+	** Types whose copies are plain byte copies and whose destructor does nothing.
+	** Containers copy these with memcpy/memmove and skip destructor loops.
+	** Arithmetic types and pointers always qualify; other types qualify when
+	** the compiler can tell (gcc/clang), or when the user specializes this.
+	*/
+#if defined(__GNUC__) || defined(__clang__)
+# define FT_IS_TRIVIALLY_COPYABLE(T) __is_trivially_copyable(T)
+#else
+# define FT_IS_TRIVIALLY_COPYABLE(T) false
+#endif
+
+	template <typename T>
+	struct is_trivially_copyable_type
+		: public is_integral_res<bool, ft::is_integral<T>::value || FT_IS_TRIVIALLY_COPYABLE(T)> {};
+
+	template <>
+	struct is_trivially_copyable_type<float> : public is_integral_res<bool, true> {};
+
+	template <>
+	struct is_trivially_copyable_type<double> : public is_integral_res<bool, true> {};
+
+	template <>
+	struct is_trivially_copyable_type<long double> : public is_integral_res<bool, true> {};
+
+	template <typename T>
+	struct is_trivially_copyable_type<T*> : public is_integral_res<bool, true> {};
+
+	template <class T>
+	struct is_trivially_copyable : ft::is_trivially_copyable_type<T> {};
+
+	/*
+	** Types that can be moved to a new address with memcpy, the old bytes being
+	** dropped without running the destructor. Every trivially copyable type is
+	** relocatable; specialize this for types that own a resource through a
+	** pointer that does not point back into the object itself.
+	*/
+	template <class T>
+	struct is_trivially_relocatable : ft::is_trivially_copyable<T> {};
+
+	/*
+	** Types whose default constructor does nothing, so storage for them can be
+	** handed out without writing to it (vector::resize_default_init).
+	*/
+#if defined(__GNUC__) || defined(__clang__)
+# define FT_IS_TRIVIALLY_DEFAULT_CONSTRUCTIBLE(T) __is_trivially_constructible(T)
+#else
+# define FT_IS_TRIVIALLY_DEFAULT_CONSTRUCTIBLE(T) false
+#endif
+
+	template <typename T>
+	struct is_trivially_default_constructible_type
+		: public is_integral_res<bool, ft::is_integral<T>::value || FT_IS_TRIVIALLY_DEFAULT_CONSTRUCTIBLE(T)> {};
+
+	template <>
+	struct is_trivially_default_constructible_type<float> : public is_integral_res<bool, true> {};
+
+	template <>
+	struct is_trivially_default_constructible_type<double> : public is_integral_res<bool, true> {};
+
+	template <>
+	struct is_trivially_default_constructible_type<long double> : public is_integral_res<bool, true> {};
+
+	template <typename T>
+	struct is_trivially_default_constructible_type<T*> : public is_integral_res<bool, true> {};
+
+	template <class T>
+	struct is_trivially_default_constructible : ft::is_trivially_default_constructible_type<T> {};
+
+	/*
+	** Allocators with pointer reallocate(pointer p, size_type old_n, size_type new_n),
+	** which can resize a block in place or by remapping it (ft::mmap_allocator).
+	*/
+	template <class Alloc>
+	struct has_reallocate_test
+	{
+		typedef char	yes[1];
+		typedef char	no[2];
+
+		template <class U, typename U::pointer (U::*)(typename U::pointer, typename U::size_type, typename U::size_type)>
+		struct check {};
+
+		template <class U>
+		static yes& test(check<U, &U::reallocate>*);
+		template <class U>
+		static no& test(...);
+
+		static const bool value = sizeof(test<Alloc>(0)) == sizeof(yes);
+	};
+
+	template <class Alloc>
+	struct has_reallocate : public is_integral_res<bool, ft::has_reallocate_test<Alloc>::value> {};
+
+	/*
+	** Byte granule an allocator hands memory out in. ft::vector rounds its
+	** capacity up to whole granules, so the storage past size() always
+	** reaches the end of the last granule (ft::aligned_allocator sets it to
+	** its alignment). 1 means no padding.
+	*/
+	template <class Alloc>
+	struct allocation_granularity
+	{
+		static const size_t value = 1;
+	};
+
+	/*
+	** Hash used by the filtered containers. Works for integral and enum keys
+	** out of the box; specialize it for anything else.
+	*/
+	template <class Key>
+	struct hash
+	{
+		size_t operator() (const Key& key) const
+		{
+			unsigned long long x = (unsigned long long)key;
+
+			x ^= x >> 33;
+			x *= 0xff51afd7ed558ccdULL;
+			x ^= x >> 33;
+			x *= 0xc4ceb9fe1a85ec53ULL;
+			x ^= x >> 33;
+			return ((size_t)x);
+		}
+	};
+
+	template <class T>
+	struct hash<T*>
+	{
+		size_t operator() (T* key) const
+		{
+			return (hash<size_t>()((size_t)key));
+		}
+	};
+
 	template<bool Cond, class T = void> struct enable_if {};
 	template<class T> struct enable_if<true, T> { typedef T type; };
 
-    template <class InputIterator1, class InputIterator2>
-	bool lexicographical_compare (InputIterator1 first1, InputIterator1 last1,
-								  InputIterator2 first2, InputIterator2 last2)
+	template <class A, class B>
+	struct is_same : public is_integral_res<bool, false> {};
+
+	template <class A>
+	struct is_same<A, A> : public is_integral_res<bool, true> {};
+
+	template <class T>
+	struct remove_const { typedef T type; };
+
+	template <class T>
+	struct remove_const<const T> { typedef T type; };
+
+	/*
+	** Types whose values are equal exactly when their bytes are: integral types
+	** and pointers. Floating point is left out (-0.0 == 0.0, NaN != NaN).
+	** Specialize is_bitwise_comparable to opt a type in.
+	*/
+	template <typename T>
+	struct is_bitwise_comparable_type : public is_integral_res<bool, ft::is_integral<T>::value> {};
+
+	template <typename T>
+	struct is_bitwise_comparable_type<T*> : public is_integral_res<bool, true> {};
+
+	template <class T>
+	struct is_bitwise_comparable : ft::is_bitwise_comparable_type<T> {};
+
+	template <class T> class random_access_iterator;
+
+	/* Iterators over contiguous storage, and the address they point at. */
+	template <class Iterator>
+	struct contiguous_iterator : public is_integral_res<bool, false>
+	{
+		typedef void	element_type;
+	};
+
+	template <class T>
+	struct contiguous_iterator<T*> : public is_integral_res<bool, true>
+	{
+		typedef typename ft::remove_const<T>::type	element_type;
+
+		static const element_type* address(T* it) { return (it); }
+	};
+
+	template <class T>
+	struct contiguous_iterator<ft::random_access_iterator<T> > : public is_integral_res<bool, true>
+	{
+		typedef typename ft::remove_const<T>::type	element_type;
+
+		static const element_type* address(const ft::random_access_iterator<T>& it) { return (it.base()); }
+	};
+
+	/* Both ranges are contiguous runs of the same bitwise comparable type. */
+	template <class Iterator1, class Iterator2>
+	struct bitwise_range : public is_integral_res<bool,
+		ft::contiguous_iterator<Iterator1>::value && ft::contiguous_iterator<Iterator2>::value
+		&& ft::is_same<typename ft::contiguous_iterator<Iterator1>::element_type,
+					   typename ft::contiguous_iterator<Iterator2>::element_type>::value
+		&& ft::is_bitwise_comparable<typename ft::contiguous_iterator<Iterator1>::element_type>::value> {};
+
+	template <class Iterator1, class Iterator2>
+	bool lexicographical_compare_impl (Iterator1 first1, Iterator1 last1, Iterator2 first2, Iterator2 last2,
+									   ft::false_type)
 	{
 		while (first1 != last1)
 		{
@@ -75,6 +290,54 @@ namespace ft
 		return (first2 != last2);
 	}
 
+	/* Finds the first differing element with simd::mismatch, then compares just that one. */
+	template <class Iterator1, class Iterator2>
+	bool lexicographical_compare_impl (Iterator1 first1, Iterator1 last1, Iterator2 first2, Iterator2 last2,
+									   ft::true_type)
+	{
+		typedef typename ft::contiguous_iterator<Iterator1>::element_type	T;
+		size_t		n1 = last1 - first1;
+		size_t		n2 = last2 - first2;
+		size_t		n = n1 < n2 ? n1 : n2;
+		const T		*a = ft::contiguous_iterator<Iterator1>::address(first1);
+		const T		*b = ft::contiguous_iterator<Iterator2>::address(first2);
+		size_t		i = ft::simd::mismatch(a, b, n * sizeof(T)) / sizeof(T);
+
+		if (i < n)
+			return (a[i] < b[i]);
+		return (n1 < n2);
+	}
+
+	template <class InputIterator1, class InputIterator2>
+	bool equal_impl (InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, ft::false_type)
+	{
+		while (first1!=last1)
+		{
+			if (!(*first1 == *first2))
+				return false;
+			++first1; ++first2;
+		}
+		return true;
+	}
+
+	template <class InputIterator1, class InputIterator2>
+	bool equal_impl (InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, ft::true_type)
+	{
+		typedef typename ft::contiguous_iterator<InputIterator1>::element_type	T;
+		size_t	bytes = (last1 - first1) * sizeof(T);
+
+		return (ft::simd::mismatch(ft::contiguous_iterator<InputIterator1>::address(first1),
+								   ft::contiguous_iterator<InputIterator2>::address(first2), bytes) == bytes);
+	}
+
+    template <class InputIterator1, class InputIterator2>
+	bool lexicographical_compare (InputIterator1 first1, InputIterator1 last1,
+								  InputIterator2 first2, InputIterator2 last2)
+	{
+		return (lexicographical_compare_impl(first1, last1, first2, last2,
+											 ft::bitwise_range<InputIterator1, InputIterator2>()));
+	}
+
     template <class InputIterator1, class InputIterator2, class Compare>
 	bool lexicographical_compare (InputIterator1 first1, InputIterator1 last1,
 								  InputIterator2 first2, InputIterator2 last2,
@@ -93,13 +356,7 @@ namespace ft
 	template <class InputIterator1, class InputIterator2>
 	bool equal ( InputIterator1 first1, InputIterator1 last1, InputIterator2 first2 )
 	{
-		while (first1!=last1)
-		{
-			if (!(*first1 == *first2))
-				return false;
-			++first1; ++first2;
-		}
-		return true;
+		return (equal_impl(first1, last1, first2, ft::bitwise_range<InputIterator1, InputIterator2>()));
 	}
 
 	template<class InputIterator1, class InputIterator2, class BinaryPredicate>
@@ -127,11 +384,28 @@ namespace ft
 
 		pair () : first(T1()), second(T2()) {};
 
+		pair (const pair& src) : first(src.first), second(src.second) {};
+
 		template<class U, class V>
 		pair (const pair<U,V>& src) : first(src.first), second(src.second) {};
 
 		pair (const first_type& a, const second_type& b) : first(a), second(b) {};
 
+#ifdef FT_CXX11
+		/* noexcept when the members' are, so FT_MOVE_IF_NOEXCEPT relocates pairs by move. */
+		pair (pair&& src) noexcept(std::is_nothrow_move_constructible<T1>::value
+				&& std::is_nothrow_move_constructible<T2>::value) :
+			first(std::move(src.first)), second(std::move(src.second)) {};
+
+		template<class U, class V>
+		pair (pair<U,V>&& src) noexcept(std::is_nothrow_constructible<T1, U&&>::value
+				&& std::is_nothrow_constructible<T2, V&&>::value) :
+			first(std::move(src.first)), second(std::move(src.second)) {};
+
+		template<class U, class V>
+		pair (U&& a, V&& b) : first(std::forward<U>(a)), second(std::forward<V>(b)) {};
+#endif
+
 		pair& operator=(const pair& src)
 		{
 			if (*this == src)
@@ -140,6 +414,18 @@ namespace ft
 			this->second = src.second;
 			return (*this);
 		}
+
+#ifdef FT_CXX11
+		pair& operator=(pair&& src) noexcept(std::is_nothrow_move_assignable<T1>::value
+				&& std::is_nothrow_move_assignable<T2>::value)
+		{
+			if (this == &src)
+				return (*this);
+			this->first = std::move(src.first);
+			this->second = std::move(src.second);
+			return (*this);
+		}
+#endif
 	};
 
 	template <class T>
@@ -151,6 +437,15 @@ namespace ft
 		typedef bool result_type;
 	};
 
+	template <class T>
+	struct plus
+	{
+		T operator() (const T& x, const T& y) const { return (x + y); }
+		typedef T first_argument_type;
+		typedef T second_argument_type;
+		typedef T result_type;
+	};
+
 	template <class T1,class T2>
 	pair<T1,T2> make_pair (T1 x, T2 y)
 	{
@@ -5,10 +5,216 @@
 #include <iostream>
 #include <memory>
 #include <stdexcept>
+#include <cstring>
 #include "iterator.hpp"
 
 namespace ft
 {
+	/*
+	** Growth step of ft::vector: the new capacity is size * Num / Den, capped
+	** to size + MaxStep when MaxStep is set, and never below what the caller
+	** needs. Specialize vector_growth for an element type to change it, e.g.
+	** template <> struct vector_growth<Foo> : ft::geometric_growth<3, 2> {};
+	*/
+	template <size_t Num, size_t Den, size_t MaxStep = 0>
+	struct geometric_growth
+	{
+		static size_t next_capacity(size_t size, size_t required)
+		{
+			size_t cap = size / Den * Num + size % Den * Num / Den;
+
+			if (MaxStep != 0 && cap > size + MaxStep)
+				cap = size + MaxStep;
+			if (cap < required)
+				cap = required;
+			return (cap);
+		}
+
+		/* Capacity to keep once size has dropped: geometric_growth keeps it all. */
+		static size_t shrink_capacity(size_t, size_t capacity)
+		{
+			return (capacity);
+		}
+	};
+
+	/*
+	** geometric_growth that also gives memory back: whenever a removal leaves
+	** the vector less than a quarter full, its capacity is halved until it is
+	** at least a quarter full again (never below MinCapacity). The vector is
+	** then under half full, so it has to double before the next growth and a
+	** size hovering around a boundary cannot make it thrash.
+	** template <> struct vector_growth<Foo> : ft::shrinking_growth<> {};
+	*/
+	template <size_t Num = 2, size_t Den = 1, size_t MaxStep = 0, size_t MinCapacity = 16>
+	struct shrinking_growth : public geometric_growth<Num, Den, MaxStep>
+	{
+		static size_t shrink_capacity(size_t size, size_t capacity)
+		{
+			while (capacity > MinCapacity && size < capacity / 4)
+				capacity /= 2;
+			return (capacity);
+		}
+	};
+
+	template <class T>
+	struct vector_growth : public geometric_growth<2, 1> {};
+
+	/* Tag for vector(n, ft::default_init): n elements, default- rather than value-initialized. */
+	struct default_init_t {};
+	static const default_init_t default_init = default_init_t();
+
+	/*
+	** Element handling shared by ft::vector and ft::small_vector, which both
+	** keep their elements in [_start, _end) of a block of raw storage and only
+	** differ in where that block lives.
+	*/
+	template <class T, class Alloc>
+	struct vector_elements
+	{
+		typedef typename Alloc::pointer													pointer;
+		typedef typename Alloc::const_pointer											const_pointer;
+		typedef typename Alloc::size_type												size_type;
+		typedef ft::random_access_iterator<T>											iterator;
+		typedef ft::random_access_iterator<const T>										const_iterator;
+		typedef ft::is_integral_res<bool, ft::is_trivially_copyable<T>::value>			trivial_tag;
+		typedef ft::is_integral_res<bool, ft::is_trivially_relocatable<T>::value>		relocatable_tag;
+
+		/*
+		** Moves [first, last) to dest and ends the lifetime of the source; the
+		** ranges may overlap. Relocatable types go through memmove.
+		*/
+		static void relocate (Alloc& alloc, pointer first, pointer last, pointer dest)
+		{
+			if (first != last && first != dest)
+				relocate(alloc, first, last, dest, relocatable_tag());
+		}
+
+		static void relocate (Alloc&, pointer first, pointer last, pointer dest, ft::true_type)
+		{
+			std::memmove(static_cast<void*>(dest), static_cast<const void*>(first), (last - first) * sizeof(T));
+		}
+
+		static void relocate (Alloc& alloc, pointer first, pointer last, pointer dest, ft::false_type)
+		{
+			if (dest < first)
+			{
+				for (; first != last; first++, dest++)
+				{
+					alloc.construct(dest, FT_MOVE_IF_NOEXCEPT(*first));
+					alloc.destroy(first);
+				}
+				return ;
+			}
+			dest += last - first;
+			while (last != first)
+			{
+				last--;
+				dest--;
+				alloc.construct(dest, FT_MOVE_IF_NOEXCEPT(*last));
+				alloc.destroy(last);
+			}
+		}
+
+		static void destroy_range (Alloc& alloc, pointer first, pointer last)
+		{
+			destroy_range(alloc, first, last, trivial_tag());
+		}
+
+		static void destroy_range (Alloc&, pointer, pointer, ft::true_type) {}
+
+		static void destroy_range (Alloc& alloc, pointer first, pointer last, ft::false_type)
+		{
+			for (; first != last; first++)
+				alloc.destroy(first);
+		}
+
+		/* Copy-constructs [first, last) into raw storage at dest. */
+		template <class InputIterator>
+		static void copy_construct (Alloc& alloc, InputIterator first, InputIterator last, pointer dest)
+		{
+			for (; first != last; first++, dest++)
+				alloc.construct(dest, *first);
+		}
+
+		static void copy_construct (Alloc& alloc, const_pointer first, const_pointer last, pointer dest)
+		{
+			if (first != last)
+				copy_construct(alloc, first, last, dest, trivial_tag());
+		}
+
+		static void copy_construct (Alloc& alloc, pointer first, pointer last, pointer dest)
+		{
+			copy_construct(alloc, const_pointer(first), const_pointer(last), dest);
+		}
+
+		static void copy_construct (Alloc& alloc, iterator first, iterator last, pointer dest)
+		{
+			copy_construct(alloc, const_pointer(first.base()), const_pointer(last.base()), dest);
+		}
+
+		static void copy_construct (Alloc& alloc, const_iterator first, const_iterator last, pointer dest)
+		{
+			copy_construct(alloc, first.base(), last.base(), dest);
+		}
+
+		static void copy_construct (Alloc&, const_pointer first, const_pointer last, pointer dest, ft::true_type)
+		{
+			std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first), (last - first) * sizeof(T));
+		}
+
+		static void copy_construct (Alloc& alloc, const_pointer first, const_pointer last, pointer dest, ft::false_type)
+		{
+			for (; first != last; first++, dest++)
+				alloc.construct(dest, *first);
+		}
+
+		/* Makes room for n more elements of v, growing by vector_growth<T>. */
+		template <class V>
+		static void grow (V& v, size_type n, const char *what)
+		{
+			if (n > v.max_size() - v.size())
+				throw std::length_error(what);
+			if (v.size() + n <= v.capacity())
+				return ;
+			size_type cap = ft::vector_growth<T>::next_capacity(v.size(), v.size() + n);
+			if (cap > v.max_size())
+				cap = v.max_size();
+			v.reserve(cap);
+		}
+
+		/*
+		** Range insertion. Forward iterators are measured first and copied in
+		** one go; single-pass input iterators (e.g. std::istream_iterator) are
+		** read exactly once, element by element.
+		*/
+		template <class V, class InputIterator>
+		static void range_insert (V& v, iterator position, InputIterator first, InputIterator last, std::input_iterator_tag)
+		{
+			if (position.base() == v._end)
+			{
+				for (; first != last; first++)
+					v.push_back(*first);
+				return ;
+			}
+			V tmp(first, last, v._alloc);
+			range_insert(v, position, tmp.begin(), tmp.end(), std::random_access_iterator_tag());
+		}
+
+		template <class V, class ForwardIterator>
+		static void range_insert (V& v, iterator position, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+		{
+			typename V::difference_type range = ft::distance(first, last);
+			if (range == 0)
+				return ;
+			typename V::difference_type ret = position.base() - v._start;
+			v.grow(range);
+			pointer pos = v._start + ret;
+			relocate(v._alloc, pos, v._end, pos + range);
+			copy_construct(v._alloc, first, last, pos);
+			v._end += range;
+		}
+	};
+
     template <class T, class Alloc = std::allocator<T> >
 	class vector
 	{
@@ -30,37 +236,209 @@ namespace ft
 		pointer         _start;
 		pointer         _end;
 		pointer         _end_capacity;
+
+		typedef ft::vector_elements<value_type, allocator_type>								elements;
+		typedef ft::is_integral_res<bool, ft::is_trivially_relocatable<value_type>::value
+										  && ft::has_reallocate<allocator_type>::value>		reallocate_tag;
+		typedef ft::is_integral_res<bool, ft::is_trivially_default_constructible<value_type>::value>	default_init_tag;
+
+		template <class, class> friend struct vector_elements;
+
+		void relocate (pointer first, pointer last, pointer dest)
+		{
+			elements::relocate(_alloc, first, last, dest);
+		}
+
+		void destroy_range (pointer first, pointer last)
+		{
+			elements::destroy_range(_alloc, first, last);
+		}
+
+		template <class InputIterator>
+		void copy_construct (InputIterator first, InputIterator last, pointer dest)
+		{
+			elements::copy_construct(_alloc, first, last, dest);
+		}
+
+		/*
+		** Range construction and assignment. Forward iterators are
+		** measured first and copied in one go; single-pass input iterators
+		** (e.g. std::istream_iterator) are read exactly once, element by element.
+		*/
+		template <class InputIterator>
+		void range_init (InputIterator first, InputIterator last, std::input_iterator_tag)
+		{
+			_start = NULL;
+			_end = NULL;
+			_end_capacity = NULL;
+			for (; first != last; first++)
+				push_back(*first);
+		}
+
+		template <class ForwardIterator>
+		void range_init (ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+		{
+			difference_type n = ft::distance(first, last);
+			size_type		cap = padded(n);
+			_start = _alloc.allocate(cap);
+			_end_capacity = _start + cap;
+			copy_construct(first, last, _start);
+			_end = _start + n;
+		}
+
+		template <class InputIterator>
+		void range_assign (InputIterator first, InputIterator last, std::input_iterator_tag)
+		{
+			erase_at_end(_start);
+			for (; first != last; first++)
+				push_back(*first);
+		}
+
+		template <class ForwardIterator>
+		void range_assign (ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+		{
+			difference_type range = ft::distance(first, last);
+			erase_at_end(_start);
+			if ((size_type)range > capacity())
+			{
+				_alloc.deallocate(_start, capacity());
+				_start = _alloc.allocate(padded(range));
+				_end_capacity = _start + padded(range);
+			}
+			copy_construct(first, last, _start);
+			_end = _start + range;
+		}
+
+		/* Default-initializes [first, last): nothing to write for trivial types. */
+		void default_construct (pointer, pointer, ft::true_type) {}
+
+		void default_construct (pointer first, pointer last, ft::false_type)
+		{
+			for (; first != last; first++)
+				_alloc.construct(first, value_type());
+		}
+
+		/* Moves the elements to a block of n; the allocator resizes in place when it can. */
+		void reallocate (size_type n, ft::true_type)
+		{
+			size_type	old_size = size();
+
+			n = padded(n);
+
+			_start = _alloc.reallocate(_start, capacity(), n);
+			_end = _start + old_size;
+			_end_capacity = _start + n;
+		}
+
+		void reallocate (size_type n, ft::false_type)
+		{
+			size_type	old_size = size();
+
+			n = padded(n);
+			pointer		new_start = _alloc.allocate(n);
+			if (_start != NULL)
+			{
+				relocate(_start, _end, new_start);
+				_alloc.deallocate(_start, capacity());
+			}
+			_start = new_start;
+			_end = _start + old_size;
+			_end_capacity = _start + n;
+		}
+
+		/*
+		** Moves the elements to a block of n >= size(), padded to whole granules;
+		** mmap-backed blocks shrink in place. A failed allocation keeps the old block.
+		*/
+		void shrink_to (size_type n)
+		{
+			if (n == 0)
+			{
+				_alloc.deallocate(_start, capacity());
+				_start = NULL;
+				_end = NULL;
+				_end_capacity = NULL;
+				return ;
+			}
+			try
+			{
+				reallocate(n, reallocate_tag());
+			}
+			catch (const std::bad_alloc&) {}
+		}
+
+		/* Lets the vector_growth policy take memory back after a removal. */
+		void auto_shrink()
+		{
+			size_type cap = ft::vector_growth<value_type>::shrink_capacity(size(), capacity());
+			if (padded(cap) < capacity())
+				shrink_to(cap < size() ? size() : cap);
+		}
+
+		/* Destroys [pos, end()) and keeps the capacity. */
+		void erase_at_end (pointer pos)
+		{
+			destroy_range(pos, _end);
+			_end = pos;
+		}
+
+		/*
+		** Smallest capacity >= n whose storage ends on an allocation granule,
+		** i.e. n rounded up to a multiple of granularity / gcd(granularity, sizeof(T)).
+		*/
+		static size_type padded (size_type n)
+		{
+			size_type	granule = ft::allocation_granularity<allocator_type>::value;
+			size_type	a = granule;
+			size_type	b = sizeof(value_type);
+
+			while (b != 0)
+			{
+				size_type r = a % b;
+				a = b;
+				b = r;
+			}
+			size_type step = granule / a;
+			if (step <= 1 || n == 0 || n > (size_type)-1 / sizeof(value_type) - step)
+				return (n);
+			return ((n + step - 1) / step * step);
+		}
+
+		/* Makes room for n more elements, growing the capacity geometrically. */
+		void grow (size_type n)
+		{
+			elements::grow(*this, n, "error vector::max_size");
+		}
     public:
         explicit vector (const allocator_type& alloc = allocator_type()) : _alloc(alloc),
 		    _start(NULL), _end(NULL), _end_capacity(NULL) {}
         explicit vector (size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type())
 		{
 			_alloc = alloc;
-			_start = _alloc.allocate(n);
+			_start = _alloc.allocate(padded(n));
 			_end = _start;
-			_end_capacity = _start + n;
-			while(_end != _end_capacity)
+			_end_capacity = _start + padded(n);
+			while(_end != _start + n)
 			{
 				_alloc.construct(_end, val);
 				_end++;
 			}
 		}
 
+		vector (size_type n, ft::default_init_t, const allocator_type& alloc = allocator_type()) : _alloc(alloc)
+		{
+			_start = _alloc.allocate(padded(n));
+			_end_capacity = _start + padded(n);
+			_end = _start + n;
+			default_construct(_start, _end, default_init_tag());
+		}
+
         template <class InputIterator>
 		vector (InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
 			    typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL)
 		{
-			difference_type n = ft::distance(first, last);
 			_alloc = alloc;
-			_start = _alloc.allocate(n);
-			_end = _start;
-			_end_capacity = _start + n;
-			while(_end != _end_capacity)
-			{
-				_alloc.construct(_end, *first);
-				_end++;
-				first++;
-			}
+			range_init(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
 		}
         
         vector (const vector& x) :
@@ -76,21 +454,45 @@ namespace ft
 		{
 			if (this == &x)
 				return (*this);
-			clear();
-			this->_start = this->_alloc.allocate(x.size());
-			this->_end = this->_start;
-			this->_end_capacity = this->_start + x.size();
-			for (const_iterator it = x.begin(); it != x.end(); it++)
+			erase_at_end(_start);
+			if (x.size() > capacity())
 			{
-				this->_alloc.construct(this->_end, *it);
-				this->_end++;
+				if (_start != NULL)
+					_alloc.deallocate(_start, capacity());
+				_start = _alloc.allocate(padded(x.size()));
+				_end_capacity = _start + padded(x.size());
 			}
+			copy_construct(x._start, x._end, _start);
+			_end = _start + x.size();
             return (*this);
 		}
 
+#ifdef FT_CXX11
+		vector (vector&& x) noexcept : _alloc(x._alloc), _start(x._start), _end(x._end), _end_capacity(x._end_capacity)
+		{
+			x._start = NULL;
+			x._end = NULL;
+			x._end_capacity = NULL;
+		}
+
+		vector& operator= (vector&& x) noexcept
+		{
+			if (this == &x)
+				return (*this);
+			erase_at_end(_start);
+			if (_start != NULL)
+				_alloc.deallocate(_start, capacity());
+			_start = NULL;
+			_end = NULL;
+			_end_capacity = NULL;
+			swap(x);
+			return (*this);
+		}
+#endif
+
         ~vector()
         {
-			clear();
+			erase_at_end(_start);
 			_alloc.deallocate(_start, capacity());
 		}
 
@@ -167,18 +569,14 @@ namespace ft
 				return ;
 			}
 			if (n > this->capacity())
-			{
-				pointer	old_start = _start;
-				pointer	old_end = _end;
-				pointer	old_cap = _end_capacity;
-				_start = _alloc.allocate(n);
-				_end = _start;
-				_end_capacity = _start + n;
-				if (old_end != NULL)
-					while (old_start != old_end)
-						_alloc.construct(_end++, *old_start++);
-				_alloc.deallocate(old_end - size(), old_cap - old_start);
-			}
+				reallocate(n, reallocate_tag());
+		}
+
+		/* Drops the unused capacity; if the smaller block cannot be had, nothing changes. */
+		void shrink_to_fit()
+		{
+			if (capacity() != padded(size()))
+				shrink_to(size());
 		}
 
         void resize (size_type n, value_type val = value_type ())
@@ -190,16 +588,67 @@ namespace ft
 			}
 			if (n < size())
 			{
-				while (size() != n)
-				{
-					_end--;
-					_alloc.destroy(_end);
-				}
+				erase_at_end(_start + n);
+				auto_shrink();
 			}
 			else
 				this->insert(this->end(), n - this->size(), val);
 		}
 
+		/*
+		** resize() without value-initialization: for trivial types the new
+		** elements keep whatever bytes the storage held, so filling them is
+		** the caller's first write.
+		*/
+		void resize_default_init (size_type n)
+		{
+			if (n < size())
+			{
+				erase_at_end(_start + n);
+				auto_shrink();
+				return ;
+			}
+			grow(n - size());
+			default_construct(_end, _start + n, default_init_tag());
+			_end = _start + n;
+		}
+
+		/* The storage; with an over-aligned allocator it starts on that alignment. */
+		pointer data()
+		{
+			return (_start);
+		}
+
+		const_pointer data() const
+		{
+			return (_start);
+		}
+
+		/*
+		** Spare capacity: the uninitialized storage past end(). Write into
+		** spare_data()[0 .. spare_capacity()), e.g. with read(2), then make the
+		** first k of those elements part of the vector with commit_spare(k).
+		** Only for trivially copyable types.
+		*/
+		pointer spare_data()
+		{
+			return (_end);
+		}
+
+		size_type spare_capacity() const
+		{
+			return (_end_capacity - _end);
+		}
+
+		void commit_spare (size_type k)
+		{
+			typedef char spare_needs_trivially_copyable[ft::is_trivially_copyable<value_type>::value ? 1 : -1];
+			(void)sizeof(spare_needs_trivially_copyable);
+			if (k > spare_capacity())
+				throw std::length_error("error vector::commit_spare");
+			_end += k;
+		}
+
         iterator erase (iterator position)
 		{
 			pointer pos = position.base();
@@ -208,176 +657,139 @@ namespace ft
 			else
 			{
 				_alloc.destroy(pos);
-				for (pointer tmp = pos + 1; tmp < _end; tmp++)
-				{
-					_alloc.construct(tmp - 1, *tmp);
-					_alloc.destroy(tmp);
-				}
+				relocate(pos + 1, _end, pos);
 			}
 			_end--;
-			return (position);
+			difference_type offset = pos - _start;
+			auto_shrink();
+			return (iterator(_start + offset));
 		}
 
         iterator erase (iterator first, iterator last)
 		{
-			difference_type n = ft::distance(first, last);
-
 			pointer left = first.base();
 			pointer right = last.base();
-			if (right == _end)
-			{
-				while (left != right)
-					_alloc.destroy(left++);
-			}
-			else
-			{
-				while (left != right)
-					_alloc.destroy(left++);
-				while (right != _end)
-				{
-					_alloc.construct(right - n, *right);
-					_alloc.destroy(right);
-					right++;
-				}
-			}
-			_end -= n;
-			return (first);
+
+			destroy_range(left, right);
+			relocate(right, _end, left);
+			_end -= right - left;
+			difference_type offset = left - _start;
+			auto_shrink();
+			return (iterator(_start + offset));
 			/*while (n--)
 				erase(first);
 			return (first);*/
 		}
 
+		/* Unordered erase: the last element moves into the hole, so nothing shifts. */
+		iterator swap_remove (iterator position)
+		{
+			pointer			pos = position.base();
+			difference_type	offset = pos - _start;
+
+			if (pos != _end - 1)
+				*pos = FT_MOVE(*(_end - 1));
+			pop_back();
+			return (iterator(_start + offset));
+		}
+
         iterator insert (iterator position, const value_type& val)
 		{
-			difference_type ret = ft::distance(this->begin(), position);
-			difference_type ret1 = ft::distance(position, this->end());
-			if (size() == capacity())
-			{
-				if(size() == 0)
-                	reserve (1);
-				else
-					reserve (size() * 2);
-            }
-			iterator it;
-			/*if (_end + 1 != _end_capacity)
-				it = _end + 1;
-			else
-            	it = _end;*/
-			it = _end;
-			for (; ret1 != 0; ret1--, it--)
-				_alloc.construct(it.base(), *(it - 1));
-			_alloc.construct(iterator(begin() + ret).base(), val);
+			difference_type ret = position.base() - _start;
+			value_type		copy(val);
+			grow(1);
+			pointer pos = _start + ret;
+			relocate(pos, _end, pos + 1);
+			_alloc.construct(pos, copy);
 			_end++;
-			return (ret + _start);
+			return (iterator(pos));
 		}
 
         void insert (iterator position, size_type n, const value_type& val)
 		{
-			if (size() + n > max_size())
-			{
-				throw std::length_error("error vector::max_size");
-				return;
-			}
 			if (n == 0)
 				return ;
-			difference_type ret1 = ft::distance(position, end());
-			difference_type ret = ft::distance(begin(), position);
-			if (size() + n > capacity())
-            {
-                if (size() == 0)
-					reserve(1);
-				else
-					reserve(size() + n);
-            }
-			iterator it;
-			if (_end + n != _end_capacity)
-				it = _end + n;
-			else
-				it = _end_capacity;
-			for (; ret1 + n - 1 != 0; ret1--, it--)
-				_alloc.construct(it.base(), *(it - n));
-			while (n--)
-			{
-				_alloc.construct(iterator(begin() + ret).base(), val);
-				ret++;
-				_end++;
-			}
+			difference_type ret = position.base() - _start;
+			value_type		copy(val);
+			grow(n);
+			pointer pos = _start + ret;
+			relocate(pos, _end, pos + n);
+			for (size_type i = 0; i != n; i++)
+				_alloc.construct(pos + i, copy);
+			_end += n;
 		}
 
         template <class InputIterator>
 			void insert (iterator position, InputIterator first, InputIterator last,
 						 typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL)
 		{
-			difference_type range = ft::distance(first, last);
-			if (range == 0)
-				return;
-			difference_type ret1 = ft::distance(position, end());
-			difference_type ret = ft::distance(begin(), position);
-			if (size() + range > capacity())
-			{
-                reserve (size() + range);
-            }
-			iterator it;
-			/*if (_end + range != _end_capacity)
-				it = _end + range;
-			else
-				it = _end_capacity;*/
-			it = _end + range - 1;
-			for (;range + ret1 - 1!= 0; it--, ret1--)
-				_alloc.construct(it.base(), *(it - range));
-			while (first != last)
-			{
-				_alloc.construct(iterator(begin() + ret).base(), *first);
-				ret++;
-				first++;
-				_end++;
-			}
+			elements::range_insert(*this, position, first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
 		}
 
         void clear()
 		{
-			size_type save_size = this->size();
-				for (size_type i = 0; i < save_size; i++)
-				{
-					_end--;
-					_alloc.destroy(_end);
-				}
+			erase_at_end(_start);
+			auto_shrink();
 		}
 
         void push_back (const value_type& val)
 		{
 			if(_end_capacity == _end)
 			{
-				if (this->size() == 0)
-					reserve(1);
-				else
-					reserve(this->size() * 2);
+				value_type copy(val);
+				grow(1);
+				_alloc.construct(_end, copy);
+				_end++;
+				return ;
 			}
 			_alloc.construct(_end, val);
 			_end++;
 		}
 
-        template <class InputIterator>
-		void assign (InputIterator first, InputIterator last,
-					 typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL)
+#ifdef FT_CXX11
+		void push_back (value_type&& val)
 		{
-			difference_type range = ft::distance(first, last);
-			clear();
-			if ((size_type)range <= capacity())
+			emplace_back(std::move(val));
+		}
+
+		template <class... Args>
+		void emplace_back (Args&&... args)
+		{
+			if (_end_capacity == _end)
 			{
-				_end = _start;
-				for (; first != last; first++, _end++)
-					_alloc.construct(_end, *first);
+				value_type tmp(std::forward<Args>(args)...);
+				grow(1);
+				_alloc.construct(_end, std::move(tmp));
 			}
 			else
-			{
-				_alloc.deallocate(_start, capacity());
-				_start = _alloc.allocate(range);
-				_end = _start;
-				_end_capacity = _start + range;
-				for (; first != last; first++, _end++)
-					_alloc.construct(_end, *first);
-			}
+				_alloc.construct(_end, std::forward<Args>(args)...);
+			_end++;
+		}
+
+		iterator insert (iterator position, value_type&& val)
+		{
+			return (emplace(position, std::move(val)));
+		}
+
+		template <class... Args>
+		iterator emplace (iterator position, Args&&... args)
+		{
+			difference_type ret = position.base() - _start;
+			value_type		tmp(std::forward<Args>(args)...);
+			grow(1);
+			pointer pos = _start + ret;
+			relocate(pos, _end, pos + 1);
+			_alloc.construct(pos, std::move(tmp));
+			_end++;
+			return (iterator(pos));
+		}
+#endif
+
+        template <class InputIterator>
+		void assign (InputIterator first, InputIterator last,
+					 typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL)
+		{
+			range_assign(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
 		}
 
         void assign (size_type n, const value_type& val)
@@ -387,7 +799,7 @@ namespace ft
 				throw std::length_error("error vector::max_size");
 				return ;
 			}
-			clear();
+			erase_at_end(_start);
 			if (n <= capacity())
 			{
 				_end = _start;
@@ -397,14 +809,14 @@ namespace ft
 			else
 			{
 				_alloc.deallocate(_start, capacity());
-				pointer new_start = _alloc.allocate(n);
+				pointer new_start = _alloc.allocate(padded(n));
 				pointer new_end = new_start;
 				iterator it;
 				for (; new_end != new_start + n; new_end++)
 					_alloc.construct(new_end, val);
 				_start = new_start;
 				_end = new_end;
-				_end_capacity = _start + n;
+				_end_capacity = _start + padded(n);
 			}
 		}
 
@@ -412,6 +824,7 @@ namespace ft
 		{
 			_alloc.destroy(_end - 1);
 			_end--;
+			auto_shrink();
 		}
 
         void swap (vector& x)
@@ -487,18 +900,7 @@ namespace ft
 	{
 		if (lhs.size() != rhs.size())
 			return (false);
-		typename ft::vector<T,Alloc>::const_iterator it_lhs = lhs.begin();
-		typename ft::vector<T,Alloc>::const_iterator it_rhs = rhs.begin();
-		while (true)
-		{
-			if (it_rhs == rhs.end() && it_lhs == lhs.end())
-				break;
-			if (*it_rhs != *it_lhs || (it_rhs == rhs.end() && it_lhs != lhs.end()))
-				return (false);
-			it_rhs++;
-			it_lhs++;
-		}
-		return (true);
+		return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
 	}
 
 	template <class T, class Alloc>
@@ -530,5 +932,108 @@ namespace ft
 	{
 		return (!(lhs < rhs));
 	}
+
+	/*
+	** Stable in-place compaction of [first, last): the elements pred rejects
+	** keep their order, each moved at most once; returns their new end.
+	*/
+	template <class T, class Pred>
+	T* compact (T* first, T* last, Pred pred, ft::false_type)
+	{
+		while (first != last && !pred(*first))
+			first++;
+		if (first == last)
+			return (last);
+		for (T* it = first + 1; it != last; it++)
+		{
+			if (!pred(*it))
+			{
+				*first = FT_MOVE(*it);
+				first++;
+			}
+		}
+		return (first);
+	}
+
+	/* Trivially copyable: copy every element, advance the output past the kept ones. */
+	template <class T, class Pred>
+	T* compact (T* first, T* last, Pred pred, ft::true_type)
+	{
+		while (first != last && !pred(*first))
+			first++;
+		if (first == last)
+			return (last);
+		T* out = first;
+		for (T* it = first + 1; it != last; it++)
+		{
+			bool drop = pred(*it);
+			*out = *it;
+			out += !drop;
+		}
+		return (out);
+	}
+
+	template <class U>
+	struct equal_to_value
+	{
+		const U&	value;
+
+		explicit equal_to_value(const U& x) : value(x) {}
+
+		template <class T>
+		bool operator() (const T& x) const
+		{
+			return (x == value);
+		}
+	};
+
+	/* Erases the elements pred accepts in one pass; returns how many went. */
+	template <class T, class Alloc, class Pred>
+	typename vector<T, Alloc>::size_type erase_if (vector<T, Alloc>& v, Pred pred)
+	{
+		typedef ft::is_integral_res<bool, ft::is_trivially_copyable<T>::value>	trivial_tag;
+		T	*first = v.data();
+		T	*last = first + v.size();
+		T	*end = ft::compact(first, last, pred, trivial_tag());
+
+		v.erase(v.begin() + (end - first), v.end());
+		return (last - end);
+	}
+
+	template <class T, class Alloc, class U>
+	typename vector<T, Alloc>::size_type erase_value (vector<T, Alloc>& v, const U& value, ft::false_type)
+	{
+		const U	val(value);
+
+		return (ft::erase_if(v, ft::equal_to_value<U>(val)));
+	}
+
+	/* 4- and 8-byte bitwise comparable elements: simd::remove_equal packs whole registers. */
+	template <class T, class Alloc, class U>
+	typename vector<T, Alloc>::size_type erase_value (vector<T, Alloc>& v, const U& value, ft::true_type)
+	{
+		const U	val(value);
+		size_t	n = v.size();
+		size_t	kept = ft::simd::remove_equal<sizeof(T)>(v.data(), n, &val);
+
+		v.erase(v.begin() + kept, v.end());
+		return (n - kept);
+	}
+
+	/*
+	** Erases every element equal to value; returns how many went. value may
+	** be an element of v: it is copied before the elements move.
+	*/
+	template <class T, class Alloc, class U>
+	typename vector<T, Alloc>::size_type erase (vector<T, Alloc>& v, const U& value)
+	{
+		typedef ft::is_integral_res<bool, ft::is_same<T, U>::value && ft::is_bitwise_comparable<T>::value
+										  && (sizeof(T) == 4 || sizeof(T) == 8)>	simd_tag;
+
+		return (ft::erase_value(v, value, simd_tag()));
+	}
 }
+
+#include "vector_bool.hpp"
+
 #endif
\ No newline at end of file
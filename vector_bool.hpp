@@ -0,0 +1,910 @@
+#pragma once
+#ifndef VECTOR_BOOL_HPP
+#define VECTOR_BOOL_HPP
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include "vector.hpp"
+#include "simd.hpp"
+
+namespace ft
+{
+	typedef unsigned long	bit_word;
+
+	static const size_t		bit_word_size = sizeof(bit_word) * CHAR_BIT;
+
+	/* One bit of an ft::vector<bool>: the word holding it and its mask. */
+	class bit_reference
+	{
+	public:
+		bit_word	*_p;
+		bit_word	_mask;
+
+		bit_reference(bit_word *p, bit_word mask) : _p(p), _mask(mask) {}
+
+		operator bool() const
+		{
+			return ((*_p & _mask) != 0);
+		}
+
+		bit_reference& operator=(bool x)
+		{
+			if (x)
+				*_p |= _mask;
+			else
+				*_p &= ~_mask;
+			return (*this);
+		}
+
+		bit_reference& operator=(const bit_reference& x)
+		{
+			return (*this = bool(x));
+		}
+
+		bool operator~() const
+		{
+			return (!bool(*this));
+		}
+
+		void flip()
+		{
+			*_p ^= _mask;
+		}
+	};
+
+	/* Position of a bit: the word it lives in and its offset inside that word. */
+	class bit_iterator_base : public iterator<std::random_access_iterator_tag, bool>
+	{
+	public:
+		typedef iterator<std::random_access_iterator_tag, bool>::difference_type	difference_type;
+
+		bit_word	*_p;
+		unsigned	_off;
+
+		bit_iterator_base(bit_word *p, unsigned off) : _p(p), _off(off) {}
+
+		void bump_up()
+		{
+			if (_off++ == bit_word_size - 1)
+			{
+				_off = 0;
+				_p++;
+			}
+		}
+
+		void bump_down()
+		{
+			if (_off-- == 0)
+			{
+				_off = bit_word_size - 1;
+				_p--;
+			}
+		}
+
+		void incr(difference_type n)
+		{
+			difference_type	bit = n + _off;
+
+			_p += bit / (difference_type)bit_word_size;
+			bit %= (difference_type)bit_word_size;
+			if (bit < 0)
+			{
+				bit += bit_word_size;
+				_p--;
+			}
+			_off = (unsigned)bit;
+		}
+
+		friend difference_type operator-(const bit_iterator_base& lco, const bit_iterator_base& rco)
+		{
+			return ((difference_type)bit_word_size * (lco._p - rco._p) + (difference_type)lco._off - (difference_type)rco._off);
+		}
+
+		friend bool operator==(const bit_iterator_base& lco, const bit_iterator_base& rco)
+		{
+			return (lco._p == rco._p && lco._off == rco._off);
+		}
+
+		friend bool operator!=(const bit_iterator_base& lco, const bit_iterator_base& rco)
+		{
+			return (!(lco == rco));
+		}
+
+		friend bool operator<(const bit_iterator_base& lco, const bit_iterator_base& rco)
+		{
+			return (lco._p < rco._p || (lco._p == rco._p && lco._off < rco._off));
+		}
+
+		friend bool operator>(const bit_iterator_base& lco, const bit_iterator_base& rco)
+		{
+			return (rco < lco);
+		}
+
+		friend bool operator<=(const bit_iterator_base& lco, const bit_iterator_base& rco)
+		{
+			return (!(rco < lco));
+		}
+
+		friend bool operator>=(const bit_iterator_base& lco, const bit_iterator_base& rco)
+		{
+			return (!(lco < rco));
+		}
+	};
+
+	class bit_iterator : public bit_iterator_base
+	{
+	public:
+		typedef bit_reference	reference;
+		typedef bit_reference*	pointer;
+
+		bit_iterator() : bit_iterator_base(NULL, 0) {}
+		bit_iterator(bit_word *p, unsigned off) : bit_iterator_base(p, off) {}
+
+		reference operator*() const
+		{
+			return (reference(_p, bit_word(1) << _off));
+		}
+
+		bit_iterator& operator++()
+		{
+			bump_up();
+			return (*this);
+		}
+
+		bit_iterator operator++(int)
+		{
+			bit_iterator tmp(*this);
+			bump_up();
+			return (tmp);
+		}
+
+		bit_iterator& operator--()
+		{
+			bump_down();
+			return (*this);
+		}
+
+		bit_iterator operator--(int)
+		{
+			bit_iterator tmp(*this);
+			bump_down();
+			return (tmp);
+		}
+
+		bit_iterator& operator+=(difference_type n)
+		{
+			incr(n);
+			return (*this);
+		}
+
+		bit_iterator& operator-=(difference_type n)
+		{
+			incr(-n);
+			return (*this);
+		}
+
+		bit_iterator operator+(difference_type n) const
+		{
+			bit_iterator tmp(*this);
+			return (tmp += n);
+		}
+
+		friend bit_iterator operator+(difference_type n, const bit_iterator& it)
+		{
+			return (it + n);
+		}
+
+		bit_iterator operator-(difference_type n) const
+		{
+			bit_iterator tmp(*this);
+			return (tmp -= n);
+		}
+
+		reference operator[](difference_type n) const
+		{
+			return (*(*this + n));
+		}
+	};
+
+	class bit_const_iterator : public bit_iterator_base
+	{
+	public:
+		typedef bool		reference;
+		typedef const bool*	pointer;
+
+		bit_const_iterator() : bit_iterator_base(NULL, 0) {}
+		bit_const_iterator(const bit_word *p, unsigned off) : bit_iterator_base(const_cast<bit_word*>(p), off) {}
+		bit_const_iterator(const bit_iterator& it) : bit_iterator_base(it._p, it._off) {}
+
+		reference operator*() const
+		{
+			return ((*_p >> _off) & 1);
+		}
+
+		bit_const_iterator& operator++()
+		{
+			bump_up();
+			return (*this);
+		}
+
+		bit_const_iterator operator++(int)
+		{
+			bit_const_iterator tmp(*this);
+			bump_up();
+			return (tmp);
+		}
+
+		bit_const_iterator& operator--()
+		{
+			bump_down();
+			return (*this);
+		}
+
+		bit_const_iterator operator--(int)
+		{
+			bit_const_iterator tmp(*this);
+			bump_down();
+			return (tmp);
+		}
+
+		bit_const_iterator& operator+=(difference_type n)
+		{
+			incr(n);
+			return (*this);
+		}
+
+		bit_const_iterator& operator-=(difference_type n)
+		{
+			incr(-n);
+			return (*this);
+		}
+
+		bit_const_iterator operator+(difference_type n) const
+		{
+			bit_const_iterator tmp(*this);
+			return (tmp += n);
+		}
+
+		friend bit_const_iterator operator+(difference_type n, const bit_const_iterator& it)
+		{
+			return (it + n);
+		}
+
+		bit_const_iterator operator-(difference_type n) const
+		{
+			bit_const_iterator tmp(*this);
+			return (tmp -= n);
+		}
+
+		reference operator[](difference_type n) const
+		{
+			return (*(*this + n));
+		}
+	};
+
+	/*
+	** Bit-packed vector<bool>: one bit per flag in an array of machine words,
+	** with bit_reference standing in for bool&. Bits between size() and the
+	** end of the last word are always zero, so count(), operator== and the
+	** bitwise operators work on whole words (popcount and SIMD from simd.hpp)
+	** without masking the tail. find_first() and find_next() return size()
+	** when there is no set bit left.
+	*/
+	template <class Alloc>
+	class vector<bool, Alloc>
+	{
+	public:
+		typedef bool													value_type;
+		typedef Alloc													allocator_type;
+		typedef ft::bit_reference										reference;
+		typedef bool													const_reference;
+		typedef ft::bit_reference*										pointer;
+		typedef const bool*												const_pointer;
+		typedef ft::bit_iterator										iterator;
+		typedef ft::bit_const_iterator									const_iterator;
+		typedef ft::reverse_iterator<iterator>							reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>					const_reverse_iterator;
+		typedef ft::bit_iterator_base::difference_type					difference_type;
+		typedef size_t													size_type;
+	private:
+		typedef typename allocator_type::template rebind<bit_word>::other	word_allocator;
+
+		/* Spelled through Alloc so vector_growth<bool> can still be specialized after this header. */
+		typedef ft::vector_growth<typename ft::enable_if<sizeof(Alloc) != 0, bool>::type>	growth;
+
+		static const size_type	word_bits = bit_word_size;
+
+		word_allocator	_alloc;
+		bit_word		*_words;
+		size_type		_size;
+		size_type		_cap;
+
+		static size_type word_count (size_type bits)
+		{
+			return ((bits + word_bits - 1) / word_bits);
+		}
+
+		/* Moves the bits to a block of n words and zeroes the words past them. */
+		void reallocate (size_type n)
+		{
+			size_type	used = word_count(_size);
+			bit_word	*words = _alloc.allocate(n);
+
+			if (used != 0)
+				std::memcpy(words, _words, used * sizeof(bit_word));
+			std::memset(words + used, 0, (n - used) * sizeof(bit_word));
+			if (_words != NULL)
+				_alloc.deallocate(_words, _cap);
+			_words = words;
+			_cap = n;
+		}
+
+		void shrink_to (size_type n)
+		{
+			if (n == 0)
+			{
+				_alloc.deallocate(_words, _cap);
+				_words = NULL;
+				_cap = 0;
+				return ;
+			}
+			try
+			{
+				reallocate(n);
+			}
+			catch (const std::bad_alloc&) {}
+		}
+
+		void auto_shrink()
+		{
+			size_type cap = growth::shrink_capacity(size(), capacity());
+			if (cap < capacity())
+				shrink_to(word_count(cap < size() ? size() : cap));
+		}
+
+		/* Zeroes the bits from pos on and makes pos the size. */
+		void erase_at_end (size_type pos)
+		{
+			fill(pos, _size, false);
+			_size = pos;
+		}
+
+		void grow (size_type n)
+		{
+			if (n > max_size() - size())
+				throw std::length_error("error vector::max_size");
+			if (size() + n <= capacity())
+				return ;
+			size_type cap = growth::next_capacity(size(), size() + n);
+			if (cap > max_size())
+				cap = max_size();
+			reserve(cap);
+		}
+
+		/* Sets or clears the bits [first, last): masked words at both ends, memset between. */
+		void fill (size_type first, size_type last, bool val)
+		{
+			if (first >= last)
+				return ;
+			size_type	fw = first / word_bits;
+			size_type	lw = (last - 1) / word_bits;
+			bit_word	fmask = ~bit_word(0) << (first % word_bits);
+			bit_word	lmask = ~bit_word(0) >> (word_bits - 1 - (last - 1) % word_bits);
+
+			if (fw == lw)
+				fmask &= lmask;
+			if (val)
+				_words[fw] |= fmask;
+			else
+				_words[fw] &= ~fmask;
+			if (fw == lw)
+				return ;
+			std::memset(_words + fw + 1, val ? 0xff : 0, (lw - fw - 1) * sizeof(bit_word));
+			if (val)
+				_words[lw] |= lmask;
+			else
+				_words[lw] &= ~lmask;
+		}
+
+		/* First set bit at or after pos, or size(). */
+		size_type find_from (size_type pos) const
+		{
+			if (pos >= _size)
+				return (_size);
+			size_type	w = pos / word_bits;
+			size_type	n = word_count(_size);
+			bit_word	bits = _words[w] & (~bit_word(0) << (pos % word_bits));
+
+			while (bits == 0)
+			{
+				if (++w == n)
+					return (_size);
+				bits = _words[w];
+			}
+			return (w * word_bits + __builtin_ctzl(bits));
+		}
+
+		void check_same_size (const vector& x, const char *what) const
+		{
+			if (x._size != _size)
+				throw std::invalid_argument(what);
+		}
+
+		void check_range (size_type first, size_type last, const char *what) const
+		{
+			if (first > last || last > _size)
+				throw std::out_of_range(what);
+		}
+
+		template <class InputIterator>
+		void range_insert (iterator position, InputIterator first, InputIterator last, std::input_iterator_tag)
+		{
+			if (position == end())
+			{
+				for (; first != last; first++)
+					push_back(*first);
+				return ;
+			}
+			vector tmp(first, last, get_allocator());
+			range_insert(position, tmp.begin(), tmp.end(), std::random_access_iterator_tag());
+		}
+
+		template <class ForwardIterator>
+		void range_insert (iterator position, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+		{
+			size_type range = ft::distance(first, last);
+			if (range == 0)
+				return ;
+			difference_type offset = position - begin();
+			grow(range);
+			iterator pos = begin() + offset;
+			std::copy_backward(pos, end(), end() + range);
+			std::copy(first, last, pos);
+			_size += range;
+		}
+
+		template <class InputIterator>
+		void range_assign (InputIterator first, InputIterator last, std::input_iterator_tag)
+		{
+			erase_at_end(0);
+			for (; first != last; first++)
+				push_back(*first);
+		}
+
+		template <class ForwardIterator>
+		void range_assign (ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+		{
+			size_type range = ft::distance(first, last);
+			erase_at_end(0);
+			reserve(range);
+			std::copy(first, last, begin());
+			_size = range;
+		}
+	public:
+		explicit vector (const allocator_type& alloc = allocator_type()) : _alloc(alloc),
+			_words(NULL), _size(0), _cap(0) {}
+
+		explicit vector (size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type()) :
+			_alloc(alloc), _words(NULL), _size(0), _cap(0)
+		{
+			assign(n, val);
+		}
+
+		template <class InputIterator>
+		vector (InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
+				typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL) :
+			_alloc(alloc), _words(NULL), _size(0), _cap(0)
+		{
+			range_assign(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+		}
+
+		vector (const vector& x) : _alloc(x._alloc), _words(NULL), _size(0), _cap(0)
+		{
+			this->operator=(x);
+		}
+
+		vector& operator= (const vector& x)
+		{
+			if (this == &x)
+				return (*this);
+			size_type	used = word_count(x._size);
+			size_type	old_used = word_count(_size);
+
+			if (used > _cap)
+			{
+				_size = 0;
+				reallocate(used);
+			}
+			if (used != 0)
+				std::memcpy(_words, x._words, used * sizeof(bit_word));
+			if (old_used > used)
+				std::memset(_words + used, 0, (old_used - used) * sizeof(bit_word));
+			_size = x._size;
+			return (*this);
+		}
+
+#ifdef FT_CXX11
+		vector (vector&& x) noexcept : _alloc(x._alloc), _words(x._words), _size(x._size), _cap(x._cap)
+		{
+			x._words = NULL;
+			x._size = 0;
+			x._cap = 0;
+		}
+
+		vector& operator= (vector&& x) noexcept
+		{
+			if (this == &x)
+				return (*this);
+			if (_words != NULL)
+				_alloc.deallocate(_words, _cap);
+			_words = NULL;
+			_size = 0;
+			_cap = 0;
+			swap(x);
+			return (*this);
+		}
+#endif
+
+		~vector()
+		{
+			if (_words != NULL)
+				_alloc.deallocate(_words, _cap);
+		}
+
+		size_type capacity (void) const
+		{
+			return (_cap * word_bits);
+		}
+
+		size_type size (void) const
+		{
+			return (_size);
+		}
+
+		size_type max_size() const
+		{
+			size_type words = _alloc.max_size();
+			size_type limit = (size_type)-1 / 2;
+
+			return (words > limit / word_bits ? limit : words * word_bits);
+		}
+
+		bool empty() const
+		{
+			return (_size == 0);
+		}
+
+		allocator_type get_allocator() const
+		{
+			return (allocator_type(_alloc));
+		}
+
+		iterator begin()
+		{
+			return (iterator(_words, 0));
+		}
+
+		const_iterator begin() const
+		{
+			return (const_iterator(_words, 0));
+		}
+
+		iterator end()
+		{
+			return (begin() + _size);
+		}
+
+		const_iterator end() const
+		{
+			return (begin() + _size);
+		}
+
+		reverse_iterator rbegin()
+		{
+			return (reverse_iterator(end()));
+		}
+
+		const_reverse_iterator rbegin() const
+		{
+			return (const_reverse_iterator(end()));
+		}
+
+		reverse_iterator rend()
+		{
+			return (reverse_iterator(begin()));
+		}
+
+		const_reverse_iterator rend() const
+		{
+			return (const_reverse_iterator(begin()));
+		}
+
+		void reserve (size_type n)
+		{
+			if (n > max_size())
+				throw std::length_error("error vector::max_size");
+			if (n > capacity())
+				reallocate(word_count(n));
+		}
+
+		void shrink_to_fit()
+		{
+			if (_cap != word_count(_size))
+				shrink_to(word_count(_size));
+		}
+
+		void resize (size_type n, value_type val = value_type())
+		{
+			if (n > max_size())
+				throw std::length_error("error vector::max_size");
+			if (n < size())
+			{
+				erase_at_end(n);
+				auto_shrink();
+			}
+			else
+				insert(end(), n - size(), val);
+		}
+
+		iterator erase (iterator position)
+		{
+			return (erase(position, position + 1));
+		}
+
+		iterator erase (iterator first, iterator last)
+		{
+			difference_type offset = first - begin();
+
+			std::copy(last, end(), first);
+			erase_at_end(_size - (last - first));
+			auto_shrink();
+			return (begin() + offset);
+		}
+
+		iterator insert (iterator position, const value_type& val)
+		{
+			difference_type offset = position - begin();
+			insert(position, 1, val);
+			return (begin() + offset);
+		}
+
+		void insert (iterator position, size_type n, const value_type& val)
+		{
+			if (n == 0)
+				return ;
+			size_type offset = position - begin();
+			grow(n);
+			iterator pos = begin() + offset;
+			std::copy_backward(pos, end(), end() + n);
+			_size += n;
+			fill(offset, offset + n, val);
+		}
+
+		template <class InputIterator>
+		void insert (iterator position, InputIterator first, InputIterator last,
+					 typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL)
+		{
+			range_insert(position, first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+		}
+
+		void clear()
+		{
+			erase_at_end(0);
+			auto_shrink();
+		}
+
+		void push_back (const value_type& val)
+		{
+			if (_size == capacity())
+				grow(1);
+			if (val)
+				_words[_size / word_bits] |= bit_word(1) << (_size % word_bits);
+			_size++;
+		}
+
+		template <class InputIterator>
+		void assign (InputIterator first, InputIterator last,
+					 typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL)
+		{
+			range_assign(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+		}
+
+		void assign (size_type n, const value_type& val)
+		{
+			if (n > max_size())
+				throw std::length_error("error vector::max_size");
+			erase_at_end(0);
+			reserve(n);
+			_size = n;
+			fill(0, n, val);
+		}
+
+		void pop_back()
+		{
+			erase_at_end(_size - 1);
+			auto_shrink();
+		}
+
+		void swap (vector& x)
+		{
+			std::swap(_alloc, x._alloc);
+			std::swap(_words, x._words);
+			std::swap(_size, x._size);
+			std::swap(_cap, x._cap);
+		}
+
+		static void swap (reference x, reference y)
+		{
+			bool tmp = x;
+			x = y;
+			y = tmp;
+		}
+
+		/* Inverts every bit. */
+		void flip()
+		{
+			size_type used = word_count(_size);
+
+			for (size_type i = 0; i != used; i++)
+				_words[i] = ~_words[i];
+			if (_size % word_bits != 0)
+				_words[used - 1] &= (bit_word(1) << (_size % word_bits)) - 1;
+		}
+
+		/* Number of set bits. */
+		size_type count() const
+		{
+			return (ft::simd::popcount(_words, word_count(_size)));
+		}
+
+		size_type find_first() const
+		{
+			return (find_from(0));
+		}
+
+		/* First set bit after pos. */
+		size_type find_next (size_type pos) const
+		{
+			if (pos >= _size)
+				return (_size);
+			return (find_from(pos + 1));
+		}
+
+		/* Sets, or clears, the bits [first, last) a word at a time. */
+		void set_range (size_type first, size_type last)
+		{
+			check_range(first, last, "vector<bool>::set_range");
+			fill(first, last, true);
+		}
+
+		void reset_range (size_type first, size_type last)
+		{
+			check_range(first, last, "vector<bool>::reset_range");
+			fill(first, last, false);
+		}
+
+		/* Bitwise operations between vectors of the same size. */
+		vector& operator&= (const vector& x)
+		{
+			check_same_size(x, "vector<bool>::operator&=");
+			ft::simd::bitwise<ft::simd::bit_and>(_words, x._words, word_count(_size));
+			return (*this);
+		}
+
+		vector& operator|= (const vector& x)
+		{
+			check_same_size(x, "vector<bool>::operator|=");
+			ft::simd::bitwise<ft::simd::bit_or>(_words, x._words, word_count(_size));
+			return (*this);
+		}
+
+		vector& operator^= (const vector& x)
+		{
+			check_same_size(x, "vector<bool>::operator^=");
+			ft::simd::bitwise<ft::simd::bit_xor>(_words, x._words, word_count(_size));
+			return (*this);
+		}
+
+		reference operator[] (size_type n)
+		{
+			return (reference(_words + n / word_bits, bit_word(1) << (n % word_bits)));
+		}
+
+		const_reference operator[] (size_type n) const
+		{
+			return ((_words[n / word_bits] >> (n % word_bits)) & 1);
+		}
+
+		reference at (size_type n)
+		{
+			if (n >= size())
+				throw std::out_of_range("vector<bool>::_M_range_check");
+			return ((*this)[n]);
+		}
+
+		const_reference at (size_type n) const
+		{
+			if (n >= size())
+				throw std::out_of_range("vector<bool>::_M_range_check");
+			return ((*this)[n]);
+		}
+
+		reference front()
+		{
+			return ((*this)[0]);
+		}
+
+		const_reference front() const
+		{
+			return ((*this)[0]);
+		}
+
+		reference back()
+		{
+			return ((*this)[_size - 1]);
+		}
+
+		const_reference back() const
+		{
+			return ((*this)[_size - 1]);
+		}
+
+		friend bool operator== (const vector& lhs, const vector& rhs)
+		{
+			size_t	bytes = word_count(lhs._size) * sizeof(bit_word);
+
+			return (lhs._size == rhs._size && ft::simd::mismatch(lhs._words, rhs._words, bytes) == bytes);
+		}
+	};
+
+	template <class Alloc>
+		vector<bool, Alloc> operator& (const vector<bool, Alloc>& lhs, const vector<bool, Alloc>& rhs)
+	{
+		vector<bool, Alloc> res(lhs);
+		return (res &= rhs);
+	}
+
+	template <class Alloc>
+		vector<bool, Alloc> operator| (const vector<bool, Alloc>& lhs, const vector<bool, Alloc>& rhs)
+	{
+		vector<bool, Alloc> res(lhs);
+		return (res |= rhs);
+	}
+
+	template <class Alloc>
+		vector<bool, Alloc> operator^ (const vector<bool, Alloc>& lhs, const vector<bool, Alloc>& rhs)
+	{
+		vector<bool, Alloc> res(lhs);
+		return (res ^= rhs);
+	}
+
+	template <class Alloc, class Pred>
+	typename vector<bool, Alloc>::size_type erase_if (vector<bool, Alloc>& v, Pred pred)
+	{
+		typename vector<bool, Alloc>::iterator	out = v.begin();
+		typename vector<bool, Alloc>::size_type	n = v.size();
+
+		for (typename vector<bool, Alloc>::iterator it = v.begin(); it != v.end(); ++it)
+		{
+			bool bit = *it;
+			if (!pred(bit))
+			{
+				*out = bit;
+				++out;
+			}
+		}
+		v.erase(out, v.end());
+		return (n - v.size());
+	}
+
+	template <class Alloc, class U>
+	typename vector<bool, Alloc>::size_type erase (vector<bool, Alloc>& v, const U& value)
+	{
+		return (ft::erase_if(v, ft::equal_to_value<U>(value)));
+	}
+}
+
+#endif